@@ -0,0 +1,380 @@
+/*
+File:			Allocators.h
+Author(s):
+	Student: Terry Ellison <ellisonterry4@gmail.com>
+
+Created:		10.18.2026
+Last Modified:	10.18.2026
+Purpose:		Allocators that can be plugged into the lab containers
+*/
+
+// Header protection
+#pragma once
+
+/************/
+/* Includes */
+/************/
+#include <new>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+// Allocates straight from the global heap (the default for the containers)
+//		Goes through the global array new, so all memory is still
+//		tracked by the test harness, and buffers made with new[] (as the
+//		unit tests do) can be handed to a container and released here
+template<typename Type>
+struct HeapAllocator {
+
+	using value_type = Type;
+
+	HeapAllocator() = default;
+
+	template<typename Other>
+	HeapAllocator(const HeapAllocator<Other>&) noexcept {}
+
+	// Get raw storage for a number of elements
+	//
+	// In:	_count			The number of elements to make room for
+	//
+	// Return: The first address of the storage
+	Type* allocate(size_t _count) {
+		return static_cast<Type*>(::operator new[](_count * sizeof(Type)));
+	}
+
+	// Release storage obtained from allocate
+	//
+	// In:	_storage		The storage to release
+	void deallocate(Type* _storage, size_t) noexcept {
+		::operator delete[](_storage);
+	}
+
+	template<typename Other>
+	bool operator==(const HeapAllocator<Other>&) const noexcept { return true; }
+
+	template<typename Other>
+	bool operator!=(const HeapAllocator<Other>&) const noexcept { return false; }
+};
+
+// A monotonic bump allocator
+//		Hands out memory from large blocks by moving a pointer forward
+//		Individual allocations are never freed, everything is released at once
+class Arena {
+
+	// Header at the front of each block (the usable memory follows it)
+	struct Block {
+		Block* next;
+	};
+
+	// Data members
+	Block* mHead = nullptr;		// Most recently allocated block
+	char* mCurrent = nullptr;	// Next free byte in the head block
+	char* mEnd = nullptr;		// One past the last byte of the head block
+	size_t mBlockSize;			// Size of the next block to allocate
+
+public:
+
+	// Constructor
+	//		No memory is allocated until the first call to Allocate
+	//
+	// In:	_blockSize		Size of the first block (doubles with every new block)
+	Arena(size_t _blockSize = 4096) : mBlockSize(_blockSize) {}
+
+	// Destructor
+	//		Releases every block
+	~Arena() {
+		Release();
+	}
+
+	Arena(const Arena&) = delete;
+	Arena& operator=(const Arena&) = delete;
+
+	// Get a piece of memory from the arena
+	//
+	// In:	_bytes			The number of bytes needed
+	//		_alignment		The required alignment (must be a power of 2)
+	//
+	// Return: The first address of the memory
+	void* Allocate(size_t _bytes, size_t _alignment = alignof(std::max_align_t)) {
+		uintptr_t aligned = Align(mCurrent, _alignment);
+
+		if (mCurrent == nullptr || aligned + _bytes > reinterpret_cast<uintptr_t>(mEnd))
+		{
+			Grow(_bytes + _alignment);
+			aligned = Align(mCurrent, _alignment);
+		}
+
+		mCurrent = reinterpret_cast<char*>(aligned + _bytes);
+		return reinterpret_cast<void*>(aligned);
+	}
+
+	// Release every block at once
+	//		All memory handed out by this arena becomes invalid
+	void Release() {
+		while (mHead != nullptr)
+		{
+			Block* next = mHead->next;
+			::operator delete(mHead);
+			mHead = next;
+		}
+
+		mCurrent = nullptr;
+		mEnd = nullptr;
+	}
+
+private:
+
+	// Round an address up to an alignment
+	static uintptr_t Align(const char* _address, size_t _alignment) {
+		return (reinterpret_cast<uintptr_t>(_address) + _alignment - 1) & ~(uintptr_t)(_alignment - 1);
+	}
+
+	// Start a new block that can hold at least _minBytes
+	void Grow(size_t _minBytes) {
+		size_t size = mBlockSize > _minBytes ? mBlockSize : _minBytes;
+
+		Block* block = static_cast<Block*>(::operator new(sizeof(Block) + size));
+		block->next = mHead;
+		mHead = block;
+
+		mCurrent = reinterpret_cast<char*>(block + 1);
+		mEnd = mCurrent + size;
+		mBlockSize *= 2;
+	}
+};
+
+// Allocates from an Arena
+//		deallocate does nothing, the memory comes back when the arena is released
+template<typename Type>
+class ArenaAllocator {
+
+	template<typename Other>
+	friend class ArenaAllocator;
+
+	Arena* mArena;
+
+public:
+
+	using value_type = Type;
+
+	ArenaAllocator(Arena& _arena) noexcept : mArena(&_arena) {}
+
+	template<typename Other>
+	ArenaAllocator(const ArenaAllocator<Other>& _other) noexcept : mArena(_other.mArena) {}
+
+	// Get storage for a number of elements from the arena
+	//
+	// In:	_count			The number of elements to make room for
+	//
+	// Return: The first address of the storage
+	Type* allocate(size_t _count) {
+		return static_cast<Type*>(mArena->Allocate(_count * sizeof(Type), alignof(Type)));
+	}
+
+	void deallocate(Type*, size_t) noexcept {}
+
+	template<typename Other>
+	bool operator==(const ArenaAllocator<Other>& _other) const noexcept { return mArena == _other.mArena; }
+
+	template<typename Other>
+	bool operator!=(const ArenaAllocator<Other>& _other) const noexcept { return mArena != _other.mArena; }
+};
+
+// A pool of equally sized slots, for containers that allocate one node at a time
+//		Slots are carved out of fixed-size slabs, freed slots go on a free list
+//		and are handed out again first, so both Allocate and Deallocate are O(1)
+//		The slot size is set by the first allocation
+class NodePool {
+
+	// A free slot holds the link to the next free slot
+	struct Slot {
+		Slot* next;
+	};
+
+	// Header at the front of each slab (aligned so the slots after it are too)
+	struct alignas(std::max_align_t) Slab {
+		Slab* next;
+	};
+
+	// Data members
+	Slab* mSlabs = nullptr;		// Every slab allocated so far
+	Slot* mFree = nullptr;		// Slots ready to be handed out
+	size_t mFreeCount = 0;		// Number of slots on the free list
+	size_t mSlotSize = 0;		// Bytes per slot (0 until the first allocation)
+	size_t mSlotsPerSlab;		// Number of slots in each slab
+
+public:
+
+	// Constructor
+	//		No memory is allocated until the first call to Allocate
+	//
+	// In:	_slotsPerSlab	Number of slots to allocate at a time
+	NodePool(size_t _slotsPerSlab = 64) : mSlotsPerSlab(_slotsPerSlab ? _slotsPerSlab : 1) {}
+
+	// Destructor
+	//		Releases every slab
+	~NodePool() {
+		Release();
+	}
+
+	NodePool(const NodePool&) = delete;
+	NodePool& operator=(const NodePool&) = delete;
+
+	// Determine if an object can live in this pool
+	//
+	// In:	_bytes			The size of the object
+	//		_alignment		The alignment of the object
+	//
+	// Return: True, if Allocate can be used for the object
+	bool Fits(size_t _bytes, size_t _alignment) const {
+		return _alignment <= alignof(std::max_align_t) && (mSlotSize == 0 || _bytes <= mSlotSize);
+	}
+
+	// Get a slot from the pool
+	//
+	// In:	_bytes			The size of the object (must pass Fits)
+	//
+	// Return: The first address of the slot
+	void* Allocate(size_t _bytes) {
+		if (mSlotSize == 0)
+			mSlotSize = RoundUp(_bytes > sizeof(Slot) ? _bytes : sizeof(Slot));
+
+		if (mFree == nullptr)
+			Grow(mSlotsPerSlab);
+
+		Slot* slot = mFree;
+		mFree = slot->next;
+		--mFreeCount;
+		return slot;
+	}
+
+	// Make sure a number of slots can be handed out without allocating again
+	//		Any shortfall is allocated as one slab
+	//
+	// In:	_count			The number of slots needed
+	//		_bytes			The size of the objects (must pass Fits)
+	void Reserve(size_t _count, size_t _bytes) {
+		if (mSlotSize == 0)
+			mSlotSize = RoundUp(_bytes > sizeof(Slot) ? _bytes : sizeof(Slot));
+
+		if (_count > mFreeCount)
+			Grow(_count - mFreeCount);
+	}
+
+	// Return a slot to the pool
+	//
+	// In:	_slot			A slot obtained from Allocate
+	void Deallocate(void* _slot) noexcept {
+		Slot* slot = static_cast<Slot*>(_slot);
+		slot->next = mFree;
+		mFree = slot;
+		++mFreeCount;
+	}
+
+	// Release every slab at once
+	//		All slots handed out by this pool become invalid
+	void Release() {
+		while (mSlabs != nullptr)
+		{
+			Slab* next = mSlabs->next;
+			::operator delete(mSlabs);
+			mSlabs = next;
+		}
+
+		mFree = nullptr;
+		mFreeCount = 0;
+	}
+
+private:
+
+	// Round a size up to a multiple of the largest fundamental alignment
+	static size_t RoundUp(size_t _bytes) {
+		return (_bytes + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+	}
+
+	// Allocate a new slab and put all of its slots on the free list
+	//
+	// In:	_slots			The number of slots in the slab
+	void Grow(size_t _slots) {
+		Slab* slab = static_cast<Slab*>(::operator new(sizeof(Slab) + mSlotSize * _slots));
+		slab->next = mSlabs;
+		mSlabs = slab;
+
+		char* first = reinterpret_cast<char*>(slab + 1);
+		for (size_t i = _slots; i > 0; --i)
+		{
+			Deallocate(first + (i - 1) * mSlotSize);
+		}
+	}
+};
+
+// Allocates single objects from a NodePool
+//		Anything the pool can not hold (arrays, larger or over-aligned types)
+//		comes from the global heap instead
+template<typename Type>
+class PoolAllocator {
+
+	template<typename Other>
+	friend class PoolAllocator;
+
+	NodePool* mPool;
+
+public:
+
+	using value_type = Type;
+
+	// Nodes can only go back to the pool they came from, so the pool travels with them
+	using propagate_on_container_copy_assignment = std::true_type;
+	using propagate_on_container_move_assignment = std::true_type;
+	using propagate_on_container_swap = std::true_type;
+
+	PoolAllocator(NodePool& _pool) noexcept : mPool(&_pool) {}
+
+	template<typename Other>
+	PoolAllocator(const PoolAllocator<Other>& _other) noexcept : mPool(_other.mPool) {}
+
+	// Get storage for a number of elements
+	//
+	// In:	_count			The number of elements to make room for
+	//
+	// Return: The first address of the storage
+	Type* allocate(size_t _count) {
+		if (_count == 1 && mPool->Fits(sizeof(Type), alignof(Type)))
+			return static_cast<Type*>(mPool->Allocate(sizeof(Type)));
+		return static_cast<Type*>(::operator new(_count * sizeof(Type)));
+	}
+
+	// Release storage obtained from allocate
+	//
+	// In:	_storage		The storage to release
+	//		_count			The number of elements it was allocated for
+	void deallocate(Type* _storage, size_t _count) noexcept {
+		if (_count == 1 && mPool->Fits(sizeof(Type), alignof(Type)))
+			mPool->Deallocate(_storage);
+		else
+			::operator delete(_storage);
+	}
+
+	// Get the pool ready to hand out a number of single elements
+	//		Lets a container grab all of its nodes in one allocation
+	//
+	// In:	_count			The number of elements that will be allocated one at a time
+	void reserve(size_t _count) {
+		if (mPool->Fits(sizeof(Type), alignof(Type)))
+			mPool->Reserve(_count, sizeof(Type));
+	}
+
+	template<typename Other>
+	bool operator==(const PoolAllocator<Other>& _other) const noexcept { return mPool == _other.mPool; }
+
+	template<typename Other>
+	bool operator!=(const PoolAllocator<Other>& _other) const noexcept { return mPool != _other.mPool; }
+};
+
+// Determine if an allocator can reserve storage ahead of time (like PoolAllocator)
+template<typename Alloc, typename = void>
+struct AllocatorHasReserve : std::false_type {};
+
+template<typename Alloc>
+struct AllocatorHasReserve<Alloc, std::void_t<decltype(std::declval<Alloc&>().reserve(size_t()))>> : std::true_type {};
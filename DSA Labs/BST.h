@@ -18,6 +18,7 @@ Notes:			Property of Full Sail University
 /* Includes */
 /************/
 #include <string>
+#include <utility>
 
 /***********/
 /* Defines */
@@ -71,6 +72,7 @@ NOTE: If the unit test is not on, that code will not be compiled!
 #define BST_IN_ORDER_TRAVERSAL					1
 #define BST_ASSIGNMENT_OP						1
 #define BST_COPY_CTOR							1
+#define BST_MOVE_SEMANTICS						1
 
 
 // Templated binary search tree
@@ -159,6 +161,47 @@ public:
 		return *this;
 	}
 
+	// Move constructor
+	//			Takes over the nodes of another object without copying them
+	//
+	// In:	_move		The object to move from (left empty)
+	BST(BST&& _move) noexcept {
+		this->mRoot = _move.mRoot;
+		_move.mRoot = NULL;
+	}
+
+	// Move assignment operator
+	//			Takes over the nodes of another object without copying them
+	//
+	// In:	_assign		The object to move from (left empty)
+	//
+	// Return:	The invoking object (by reference)
+	BST& operator=(BST&& _assign) noexcept {
+		if (this != &_assign)
+		{
+			if (this->mRoot != NULL)
+			{
+				this->Clear();
+			}
+
+			this->mRoot = _assign.mRoot;
+			_assign.mRoot = NULL;
+		}
+		return *this;
+	}
+
+	// Exchange the contents of two trees
+	//
+	// In:	_other		The tree to swap with
+	void Swap(BST& _other) noexcept {
+		std::swap(this->mRoot, _other.mRoot);
+	}
+
+	// Exchange the contents of two trees (found by std::swap-style calls)
+	friend void swap(BST& _a, BST& _b) noexcept {
+		_a.Swap(_b);
+	}
+
 private:
 	// Recursive helper method for use with Rule of 3
 	// 
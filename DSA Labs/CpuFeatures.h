@@ -0,0 +1,83 @@
+/*
+File:			CpuFeatures.h
+Author(s):
+	Student: Terry Ellison <ellisonterry4@gmail.com>
+
+Created:		10.18.2026
+Last Modified:	10.18.2026
+Purpose:		Detects which SIMD instruction sets the running CPU supports,
+				so vector kernels can be picked at runtime
+*/
+
+// Header protection
+#pragma once
+
+/************/
+/* Includes */
+/************/
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define SIMD_X86	1
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#else
+#define SIMD_X86	0
+#endif
+
+// MSVC lets any function use any intrinsic, GCC and Clang have to be told per function
+#if SIMD_X86 && (defined(__GNUC__) || defined(__clang__))
+#define SIMD_TARGET(isa)	__attribute__((target(isa)))
+#else
+#define SIMD_TARGET(isa)
+#endif
+
+// The instruction sets the kernels care about
+struct CpuFeatures {
+	bool sse2 = false;
+	bool sse41 = false;
+	bool avx2 = false;
+	bool avx512f = false;
+};
+
+// Ask the CPU (and OS, for AVX2 and AVX-512) what it supports
+//		Only runs the detection once
+//
+// Return: The supported instruction sets
+inline const CpuFeatures& GetCpuFeatures() {
+	static const CpuFeatures features = []() -> CpuFeatures
+	{
+		CpuFeatures detected;
+#if SIMD_X86
+#ifdef _MSC_VER
+		int info[4];
+		__cpuid(info, 0);
+		int highestLeaf = info[0];
+
+		__cpuid(info, 1);
+		detected.sse2 = (info[3] & (1 << 26)) != 0;
+		detected.sse41 = (info[2] & (1 << 19)) != 0;
+		bool osXsave = (info[2] & (1 << 27)) != 0;
+		unsigned long long savedState = osXsave ? _xgetbv(0) : 0;
+		bool osSavesYmm = osXsave && (info[2] & (1 << 28)) != 0 && (savedState & 6) == 6;
+		bool osSavesZmm = osSavesYmm && (savedState & 0xE0) == 0xE0;
+
+		if (highestLeaf >= 7 && osSavesYmm)
+		{
+			__cpuidex(info, 7, 0);
+			detected.avx2 = (info[1] & (1 << 5)) != 0;
+			detected.avx512f = osSavesZmm && (info[1] & (1 << 16)) != 0;
+		}
+#else
+		__builtin_cpu_init();
+		detected.sse2 = __builtin_cpu_supports("sse2");
+		detected.sse41 = __builtin_cpu_supports("sse4.1");
+		detected.avx2 = __builtin_cpu_supports("avx2");
+		detected.avx512f = __builtin_cpu_supports("avx512f");
+#endif
+#endif
+		return detected;
+	}();
+
+	return features;
+}
@@ -62,8 +62,24 @@ NOTE: If the unit test is not on, that code will not be compiled!
 #define LAB3_ERASE_MIDDLE				1
 #define LAB3_ASSIGNMENT_OP				1
 #define LAB3_COPY_CTOR					1
-
-template<typename Type>
+#define LAB3_MOVE_SEMANTICS				1
+#define LAB3_STRESS						1
+#define LAB3_UNROLLED					1
+#define LAB3_INTRUSIVE					1
+#define LAB3_POOL						1
+#define LAB3_SPLICE						1
+#define LAB3_POOL_BENCHMARK				0
+#define LAB3_SPLICE_BENCHMARK			0
+
+/************/
+/* Includes */
+/************/
+#include <functional>
+#include <memory>
+#include <utility>
+#include "Allocators.h"
+
+template<typename Type, typename Allocator = HeapAllocator<Type>>
 class DList {
 
 	friend class UnitTests_Lab3;	// Giving access to test code
@@ -96,6 +112,10 @@ class DList {
 		}
 	};
 
+	// Nodes are allocated with the Allocator, rebound to Node
+	using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+	using NodeTraits = std::allocator_traits<NodeAllocator>;
+
 public:
 
 	class Iterator {
@@ -233,12 +253,15 @@ public:
 	Node* mHead = reinterpret_cast<Node*>(-1);
 	Node* mTail = reinterpret_cast<Node*>(-1);
 	size_t mSize = -1;
+	NodeAllocator mAllocator;
 
 public:
 
 	// Default constructor
 	//		Creates a new empty linked list
-	DList() {
+	//
+	// In:	_allocator		Where the nodes come from (a PoolAllocator recycles erased nodes)
+	DList(const Allocator& _allocator = Allocator()) : mAllocator(_allocator) {
 		mHead = NULL;
 		mTail = NULL;
 		mSize = 0;
@@ -253,10 +276,7 @@ public:
 	// Copy constructor
 	//		Used to initialize one object to another
 	// In:	_copy			The object to copy from
-	DList(const DList& _copy)  {
-		this->mHead = NULL;
-		this->mTail = NULL;
-		this->mSize = 0;
+	DList(const DList& _copy) : DList(Allocator(NodeTraits::select_on_container_copy_construction(_copy.mAllocator))) {
 		*this = _copy;
 	}
 
@@ -271,39 +291,122 @@ public:
 		{
 			if (this->mHead != NULL)
 				this->Clear();
-			RecursiveCopy(_assign.mHead);
+			if constexpr (NodeTraits::propagate_on_container_copy_assignment::value)
+			{
+				this->mAllocator = _assign.mAllocator;
+			}
+			if constexpr (AllocatorHasReserve<NodeAllocator>::value)
+			{
+				this->mAllocator.reserve(_assign.mSize);
+			}
+			CopyNodes(_assign.mHead);
 		}
 			
 		return *this;
 	}
 
-private:
-	// Optional recursive helper method for use with Rule of 3
+	// Move constructor
+	//		Takes over the nodes of another object without copying them
+	// In:	_move			The object to move from (left empty)
+	DList(DList&& _move) noexcept : mAllocator(_move.mAllocator) {
+		this->mHead = _move.mHead;
+		this->mTail = _move.mTail;
+		this->mSize = _move.mSize;
+
+		_move.mHead = NULL;
+		_move.mTail = NULL;
+		_move.mSize = 0;
+	}
+
+	// Move assignment operator
+	//		Takes over the nodes of another object without copying them
+	// In:	_assign			The object to move from (left empty)
 	//
-	// In:	_curr		The current Node to copy
-	void RecursiveCopy(const Node* _curr) {
-		Node* prev = nullptr;
-	
-		if (_curr->next != NULL)
+	// Return: The invoking object (by reference)
+	DList& operator=(DList&& _assign) noexcept(NodeTraits::propagate_on_container_move_assignment::value ||
+		NodeTraits::is_always_equal::value) {
+		if (this != &_assign)
 		{
-			if (this->mHead == NULL) // list is empty
+			this->Clear();
+			if constexpr (NodeTraits::propagate_on_container_move_assignment::value)
 			{
-				this->mHead = new Node(_curr->data);
-				prev = this->mHead;
-				++mSize;
+				this->mAllocator = std::move(_assign.mAllocator);
+				this->Swap(_assign);
 			}
 			else
 			{
-				prev = mTail;	
+				if (this->mAllocator == _assign.mAllocator)
+					this->Swap(_assign);
+				else
+				{
+					// The nodes cannot change allocators, so the values are copied over
+					*this = static_cast<const DList&>(_assign);
+					_assign.Clear();
+				}
 			}
+		}
 
-			mTail = new Node(_curr->next->data);
-			mTail->prev = prev;
-			prev->next = mTail;
-			RecursiveCopy(_curr->next);
-			++mSize;
+		return *this;
+	}
+
+	// Exchange the contents of two lists
+	//		Allocators are only swapped if they propagate on swap
+	// In:	_other			The list to swap with
+	void Swap(DList& _other) noexcept {
+		if constexpr (NodeTraits::propagate_on_container_swap::value)
+		{
+			std::swap(this->mAllocator, _other.mAllocator);
+		}
+		std::swap(this->mHead, _other.mHead);
+		std::swap(this->mTail, _other.mTail);
+		std::swap(this->mSize, _other.mSize);
+	}
+
+	// Exchange the contents of two lists (found by std::swap-style calls)
+	friend void swap(DList& _a, DList& _b) noexcept {
+		_a.Swap(_b);
+	}
+
+private:
+	// Helper method for use with Rule of 3
+	//		Appends a copy of every node from _curr to the end of the chain
+	//		Works one node at a time, so any length of list can be copied
+	//
+	// In:	_curr		The first Node to copy
+	void CopyNodes(const Node* _curr) {
+		for (; _curr != NULL; _curr = _curr->next)
+		{
+			AddTail(_curr->data);
+		}
+	}
+
+	// Allocate and construct a node with the list's allocator
+	//
+	// In:	_data		The value for the node
+	//
+	// Return: The new node (next and prev are null)
+	Node* NewNode(const Type& _data) {
+		Node* node = NodeTraits::allocate(mAllocator, 1);
+
+		try
+		{
+			NodeTraits::construct(mAllocator, node, _data);
+		}
+		catch (...)
+		{
+			NodeTraits::deallocate(mAllocator, node, 1);
+			throw;
 		}
-		return;
+
+		return node;
+	}
+
+	// Destroy a node and give its memory back to the list's allocator
+	//
+	// In:	_node		The node to delete
+	void DeleteNode(Node* _node) {
+		NodeTraits::destroy(mAllocator, _node);
+		NodeTraits::deallocate(mAllocator, _node, 1);
 	}
 
 public:
@@ -311,7 +414,7 @@ public:
 	//
 	// In:	_data			The object to add to the list
 	void AddHead(const Type& _data) {
-		Node* temp = new Node(_data);
+		Node* temp = NewNode(_data);
 
 		if (mHead == NULL)
 		{
@@ -333,7 +436,7 @@ public:
 	//
 	// In:	_data			The object to add to the list
 	void AddTail(const Type& _data) {
-		Node* temp = new Node(_data);
+		Node* temp = NewNode(_data);
 
 		if (mTail == NULL)
 		{
@@ -352,29 +455,20 @@ public:
 
 	// Clear the list of all dynamic memory
 	//			Resets the list to its default state
+	//			Works one node at a time, so any length of list can be cleared
 	void Clear() {
-		RecursiveClear(this->mHead);
-		mHead = NULL;
-		mTail = NULL;
-	}
-
-private:
-	// Optional recursive helper method for use with Clear
-	// 
-	// In:	_curr		The current Node to clear
-	void RecursiveClear(const Node* _curr) {
-		if (_curr != NULL)
+		Node* curr = this->mHead;
+		while (curr != NULL)
 		{
-			Node* next = _curr->next;
-			RecursiveClear(next);
-			delete _curr;
-			_curr = NULL;
-			--mSize;
+			Node* next = curr->next;
+			DeleteNode(curr);
+			curr = next;
 		}
-		return;
-	}
 
-public:
+		mHead = NULL;
+		mTail = NULL;
+		mSize = 0;
+	}
 
 	// Insert a piece of data *before* the passed-in iterator
 	//
@@ -397,7 +491,7 @@ public:
 	// SPECIAL CASE:	Inserting at head or empty list
 	// NOTE:	The iterator should now be pointing to the new node created
 	Iterator Insert(Iterator& _iter, const Type& _data) {
-		Node* temp = new Node(_data);
+		Node* temp = NewNode(_data);
 		Node* before = _iter.mCurr;
 		
 		if (this->mHead == NULL)
@@ -455,7 +549,7 @@ public:
 		{
 			temp = mHead;
 			mHead = mHead->next;
-			delete temp;
+			DeleteNode(temp);
 			mHead->prev = NULL;
 			_iter.mCurr = mHead;
 		}
@@ -463,7 +557,7 @@ public:
 		{
 			temp = mTail;
 			mTail = mTail->prev;
-			delete temp;
+			DeleteNode(temp);
 			mTail->next = NULL;
 			_iter.mCurr = nullptr;
 		}
@@ -473,12 +567,229 @@ public:
 			_iter.mCurr = temp->next;
 			temp->prev->next = temp->next;
 			temp->next->prev = temp->prev;
-			delete temp;
+			DeleteNode(temp);
 		}
 		--mSize;
 		return _iter;
 	}
 
+	// Move every node of another list in front of an iterator
+	//		Nodes are relinked, nothing is allocated or copied
+	//
+	// In:	_pos		The iterator to insert before (End adds to the tail)
+	//		_other		The list to take the nodes from (left empty)
+	//
+	// NOTE:	Both lists must use equal allocators
+	void Splice(const Iterator& _pos, DList& _other) {
+		if (&_other == this || _other.mHead == NULL)
+			return;
+
+		LinkRange(_pos.mCurr, _other.mHead, _other.mTail);
+		mSize += _other.mSize;
+
+		_other.mHead = NULL;
+		_other.mTail = NULL;
+		_other.mSize = 0;
+	}
+
+	// Move a single node from a list (this one included) in front of an iterator
+	//
+	// In:	_pos		The iterator to insert before (End adds to the tail)
+	//		_other		The list that owns the node
+	//		_node		The node to move
+	//
+	// NOTE:	Both lists must use equal allocators
+	void Splice(const Iterator& _pos, DList& _other, const Iterator& _node) {
+		Node* node = _node.mCurr;
+		if (node == NULL || node == _pos.mCurr)
+			return;
+
+		_other.UnlinkRange(node, node);
+		--_other.mSize;
+
+		LinkRange(_pos.mCurr, node, node);
+		++mSize;
+	}
+
+	// Move the nodes [_first, _last) from a list (this one included) in front of an iterator
+	//		O(1) within one list, otherwise the moved nodes are counted to keep both sizes right
+	//
+	// In:	_pos		The iterator to insert before (End adds to the tail, must not be inside the range)
+	//		_other		The list that owns the nodes
+	//		_first		The first node to move
+	//		_last		One past the last node to move
+	//
+	// NOTE:	Both lists must use equal allocators
+	void Splice(const Iterator& _pos, DList& _other, const Iterator& _first, const Iterator& _last) {
+		Node* first = _first.mCurr;
+		if (first == NULL || first == _last.mCurr)
+			return;
+
+		Node* last = _last.mCurr != NULL ? _last.mCurr->prev : _other.mTail;
+
+		if (&_other != this)
+		{
+			size_t count = 1;
+			for (const Node* curr = first; curr != last; curr = curr->next)
+			{
+				++count;
+			}
+			_other.mSize -= count;
+			mSize += count;
+		}
+
+		_other.UnlinkRange(first, last);
+		LinkRange(_pos.mCurr, first, last);
+	}
+
+	// Merge another sorted list into this sorted list
+	//		Nodes are relinked, nothing is allocated or copied
+	//		Equal values keep this list's values first
+	//
+	// In:	_other		The list to merge in (left empty)
+	//		_comp		The ordering both lists are sorted by
+	//
+	// NOTE:	Both lists must use equal allocators
+	template<typename Compare = std::less<Type>>
+	void Merge(DList& _other, Compare _comp = Compare()) {
+		if (&_other == this || _other.mHead == NULL)
+			return;
+
+		mHead = MergeChains(mHead, _other.mHead, _comp);
+		mSize += _other.mSize;
+		RelinkPrev();
+
+		_other.mHead = NULL;
+		_other.mTail = NULL;
+		_other.mSize = 0;
+	}
+
+	// Sort the list by relinking its nodes (a stable bottom-up merge sort)
+	//		O(n log n), nothing is allocated or copied
+	//
+	// In:	_comp		The ordering to sort by
+	template<typename Compare = std::less<Type>>
+	void Sort(Compare _comp = Compare()) {
+		if (mSize < 2)
+			return;
+
+		// bins[i] is either empty or a sorted chain of 2^i nodes,
+		// with higher bins holding nodes from earlier in the list
+		Node* bins[64] = {};
+
+		Node* curr = mHead;
+		while (curr != NULL)
+		{
+			Node* next = curr->next;
+			curr->next = NULL;
+
+			Node* carry = curr;
+			size_t bin = 0;
+			for (; bins[bin] != NULL; ++bin)
+			{
+				carry = MergeChains(bins[bin], carry, _comp);
+				bins[bin] = NULL;
+			}
+			bins[bin] = carry;
+
+			curr = next;
+		}
+
+		Node* sorted = NULL;
+		for (Node* chain : bins)
+		{
+			if (chain != NULL)
+				sorted = MergeChains(chain, sorted, _comp);
+		}
+
+		mHead = sorted;
+		RelinkPrev();
+	}
+
+private:
+
+	// Link a chain of nodes in front of a node
+	//
+	// In:	_pos		The node to link in front of (null links at the tail)
+	//		_first		The first node of the chain
+	//		_last		The last node of the chain
+	void LinkRange(Node* _pos, Node* _first, Node* _last) {
+		Node* before = _pos != NULL ? _pos->prev : mTail;
+
+		_first->prev = before;
+		_last->next = _pos;
+
+		if (before != NULL)
+			before->next = _first;
+		else
+			mHead = _first;
+
+		if (_pos != NULL)
+			_pos->prev = _last;
+		else
+			mTail = _last;
+	}
+
+	// Take a chain of nodes out of the list (does not change mSize)
+	//
+	// In:	_first		The first node of the chain
+	//		_last		The last node of the chain
+	void UnlinkRange(Node* _first, Node* _last) {
+		if (_first->prev != NULL)
+			_first->prev->next = _last->next;
+		else
+			mHead = _last->next;
+
+		if (_last->next != NULL)
+			_last->next->prev = _first->prev;
+		else
+			mTail = _first->prev;
+
+		_first->prev = NULL;
+		_last->next = NULL;
+	}
+
+	// Merge two sorted, null-terminated chains using only their next pointers
+	//		Ties take the node from _a first
+	//
+	// Return: The head of the merged chain
+	template<typename Compare>
+	static Node* MergeChains(Node* _a, Node* _b, Compare& _comp) {
+		Node* head = NULL;
+		Node** tail = &head;
+
+		while (_a != NULL && _b != NULL)
+		{
+			if (_comp(_b->data, _a->data))
+			{
+				*tail = _b;
+				_b = _b->next;
+			}
+			else
+			{
+				*tail = _a;
+				_a = _a->next;
+			}
+			tail = &(*tail)->next;
+		}
+
+		*tail = _a != NULL ? _a : _b;
+		return head;
+	}
+
+	// Walk forward from mHead, fixing every prev pointer and mTail
+	void RelinkPrev() {
+		Node* prev = NULL;
+		for (Node* curr = mHead; curr != NULL; curr = curr->next)
+		{
+			curr->prev = prev;
+			prev = curr;
+		}
+		mTail = prev;
+	}
+
+public:
+
 	// Set an Iterator at the front of the list
 	// 
 	// Return: An iterator that has its curr pointing to the list's head
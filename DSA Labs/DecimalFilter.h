@@ -0,0 +1,240 @@
+/*
+File:			DecimalFilter.h
+Author(s):
+	Student: Terry Ellison <ellisonterry4@gmail.com>
+
+Created:		10.18.2026
+Last Modified:	10.18.2026
+Purpose:		The DSA_Lab4::RemoveDecimalGreater test run over whole float
+				arrays at once, using SSE4.1, AVX2 or AVX-512 when the CPU has them
+*/
+
+// Header protection
+#pragma once
+
+/************/
+/* Includes */
+/************/
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include "CpuFeatures.h"
+
+// Signature shared by every filter kernel
+//		A value is dropped when v - floor(v) > _decimal (the same test as
+//		DSA_Lab4::RemoveDecimalGreater), every other value is kept in order
+//
+// In:	_in			The values to filter
+//		_count		The number of values
+//		_decimal	The decimal value to check against
+//		_out		Receives the kept values (room for _count), may be the same as _in,
+//					or null to only count them
+//
+// Return: The number of values kept
+using DecimalFilterKernel = size_t(*)(const float* _in, size_t _count, float _decimal, float* _out);
+
+// Reference kernel, one value at a time
+//		Every value is written and the output position only moves on for kept values,
+//		so there is no branch on the test
+inline size_t FilterDecimalGreaterScalar(const float* _in, size_t _count, float _decimal, float* _out) {
+	size_t kept = 0;
+
+	if (_out == nullptr)
+	{
+		for (size_t i = 0; i < _count; ++i)
+		{
+			kept += !(_in[i] - std::floor(_in[i]) > _decimal);
+		}
+		return kept;
+	}
+
+	for (size_t i = 0; i < _count; ++i)
+	{
+		float v = _in[i];
+		_out[kept] = v;
+		kept += !(v - std::floor(v) > _decimal);
+	}
+	return kept;
+}
+
+#if SIMD_X86
+
+// Lookup tables that turn a mask of kept lanes into a compress shuffle
+struct DecimalFilterTables {
+	uint8_t shuffle[16][16];	// pshufb control packing the kept lanes of 4 floats to the front
+	uint32_t permute[256][8];	// vpermps indices packing the kept lanes of 8 floats to the front
+	uint8_t bits[256];			// Number of set bits in a byte
+};
+
+// Return: The lookup tables (built the first time they are asked for)
+inline const DecimalFilterTables& GetDecimalFilterTables() {
+	static const DecimalFilterTables tables = []() -> DecimalFilterTables
+	{
+		DecimalFilterTables built = {};
+		for (int mask = 0; mask < 256; ++mask)
+		{
+			int kept = 0;
+			for (int lane = 0; lane < 8; ++lane)
+			{
+				if (mask & (1 << lane))
+				{
+					built.permute[mask][kept] = (uint32_t)lane;
+					if (mask < 16)
+					{
+						for (int byte = 0; byte < 4; ++byte)
+						{
+							built.shuffle[mask][kept * 4 + byte] = (uint8_t)(lane * 4 + byte);
+						}
+					}
+					++kept;
+				}
+			}
+			built.bits[mask] = (uint8_t)kept;
+		}
+		return built;
+	}();
+
+	return tables;
+}
+
+// Filters four values per step
+//		The kept lanes are shuffled to the front of the register and the whole
+//		register is stored, the next store overwrites anything past the kept lanes
+//		(never past the block just read, so filtering in place is safe)
+SIMD_TARGET("sse4.1")
+inline size_t FilterDecimalGreaterSSE41(const float* _in, size_t _count, float _decimal, float* _out) {
+	const DecimalFilterTables& tables = GetDecimalFilterTables();
+	const __m128 decimal = _mm_set1_ps(_decimal);
+
+	size_t i = 0, kept = 0;
+	for (; i + 4 <= _count; i += 4)
+	{
+		__m128 v = _mm_loadu_ps(_in + i);
+		__m128 fraction = _mm_sub_ps(v, _mm_floor_ps(v));
+		int mask = _mm_movemask_ps(_mm_cmpngt_ps(fraction, decimal));
+
+		if (_out != nullptr)
+		{
+			__m128i control = _mm_loadu_si128(reinterpret_cast<const __m128i*>(tables.shuffle[mask]));
+			__m128 packed = _mm_castsi128_ps(_mm_shuffle_epi8(_mm_castps_si128(v), control));
+			_mm_storeu_ps(_out + kept, packed);
+		}
+		kept += tables.bits[mask];
+	}
+
+	return kept + FilterDecimalGreaterScalar(_in + i, _count - i, _decimal, _out != nullptr ? _out + kept : nullptr);
+}
+
+// Filters eight values per step (same approach as the SSE4.1 kernel, with vpermps)
+SIMD_TARGET("avx2")
+inline size_t FilterDecimalGreaterAVX2(const float* _in, size_t _count, float _decimal, float* _out) {
+	const DecimalFilterTables& tables = GetDecimalFilterTables();
+	const __m256 decimal = _mm256_set1_ps(_decimal);
+
+	size_t i = 0, kept = 0;
+	for (; i + 8 <= _count; i += 8)
+	{
+		__m256 v = _mm256_loadu_ps(_in + i);
+		__m256 fraction = _mm256_sub_ps(v, _mm256_floor_ps(v));
+		int mask = _mm256_movemask_ps(_mm256_cmp_ps(fraction, decimal, _CMP_NGT_UQ));
+
+		if (_out != nullptr)
+		{
+			__m256i indices = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(tables.permute[mask]));
+			_mm256_storeu_ps(_out + kept, _mm256_permutevar8x32_ps(v, indices));
+		}
+		kept += tables.bits[mask];
+	}
+
+	return kept + FilterDecimalGreaterScalar(_in + i, _count - i, _decimal, _out != nullptr ? _out + kept : nullptr);
+}
+
+// Filters sixteen values per step with the AVX-512 compress instruction
+//		The tail is handled with masked loads, so there is no scalar loop
+//		Compresses into a register and does a masked store (a compress straight
+//		to memory is much slower on some CPUs)
+SIMD_TARGET("avx512f")
+inline size_t FilterDecimalGreaterAVX512(const float* _in, size_t _count, float _decimal, float* _out) {
+	const DecimalFilterTables& tables = GetDecimalFilterTables();
+	const __m512 decimal = _mm512_set1_ps(_decimal);
+
+	size_t kept = 0;
+	for (size_t i = 0; i < _count; i += 16)
+	{
+		__mmask16 valid = _count - i >= 16 ? (__mmask16)0xFFFF : (__mmask16)((1u << (_count - i)) - 1);
+		__m512 v = _mm512_maskz_loadu_ps(valid, _in + i);
+		__m512 fraction = _mm512_sub_ps(v, _mm512_roundscale_ps(v, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC));
+		__mmask16 mask = _mm512_mask_cmp_ps_mask(valid, fraction, decimal, _CMP_NGT_UQ);
+
+		unsigned int keptHere = tables.bits[mask & 0xFF] + tables.bits[mask >> 8];
+		if (_out != nullptr)
+		{
+			__m512 packed = _mm512_maskz_compress_ps(mask, v);
+			_mm512_mask_storeu_ps(_out + kept, (__mmask16)((1u << keptHere) - 1), packed);
+		}
+		kept += keptHere;
+	}
+
+	return kept;
+}
+
+#endif
+
+// Pick the fastest filter kernel the CPU running the program supports
+//
+// Return: The kernel to use
+inline DecimalFilterKernel SelectDecimalFilterKernel() {
+#if SIMD_X86
+	const CpuFeatures& cpu = GetCpuFeatures();
+
+	if (cpu.avx512f)
+		return FilterDecimalGreaterAVX512;
+	if (cpu.avx2)
+		return FilterDecimalGreaterAVX2;
+	if (cpu.sse41)
+		return FilterDecimalGreaterSSE41;
+#endif
+
+	return FilterDecimalGreaterScalar;
+}
+
+// Return: The kernel picked for this CPU (picked the first time this is called)
+inline DecimalFilterKernel GetDecimalFilterKernel() {
+	static const DecimalFilterKernel kernel = SelectDecimalFilterKernel();
+	return kernel;
+}
+
+// Count the values RemoveDecimalGreater would remove, without moving anything
+//
+// In:	_in			The values to check
+//		_count		The number of values
+//		_decimal	The decimal value to check against
+//
+// Return: The number of values with a decimal place > _decimal
+inline size_t CountDecimalGreater(const float* _in, size_t _count, float _decimal) {
+	return _count - GetDecimalFilterKernel()(_in, _count, _decimal, nullptr);
+}
+
+// Copy every value that does *not* have a decimal place > _decimal, in order
+//
+// In:	_in			The values to filter
+//		_count		The number of values
+//		_decimal	The decimal value to check against
+//		_out		Receives the kept values (needs room for _count)
+//
+// Return: The number of values copied
+inline size_t CopyWithoutDecimalGreater(const float* _in, size_t _count, float _decimal, float* _out) {
+	return GetDecimalFilterKernel()(_in, _count, _decimal, _out);
+}
+
+// Remove every value that has a decimal place > _decimal, in place
+//		The kept values are packed to the front in their original order
+//
+// In:	_values		The values to filter
+//		_count		The number of values
+//		_decimal	The decimal value to check against
+//
+// Return: The total number of values removed
+inline size_t RemoveDecimalGreaterInPlace(float* _values, size_t _count, float _decimal) {
+	return _count - GetDecimalFilterKernel()(_values, _count, _decimal, _values);
+}
@@ -49,11 +49,15 @@ NOTE: If the unit test is not on, that code will not be compiled!
 #define LAB5_REMOVE_NOT_FOUND		1
 #define LAB5_ASSIGNMENT_OP			1
 #define LAB5_COPY_CTOR				1
+#define LAB5_MOVE_SEMANTICS			1
+#define LAB5_REHASH					1
+#define LAB5_FLAT_DICTIONARY		1
 
 /************/
 /* Includes */
 /************/
 #include <list>
+#include <utility>
 
 template<typename Key, typename Value>
 class Dictionary {
@@ -87,17 +91,28 @@ class Dictionary {
 	size_t mNumBuckets = -1;																	// Number of elements in mTable
 	unsigned int(*mHashFunc)(const Key&) = reinterpret_cast<unsigned int(*)(const Key&)>(-1);	// Pointer to the hash function
 
+	// Growth (off until a max load factor is set, so the table keeps the size it was made with)
+	size_t mSize = 0;										// Number of pairs stored
+	float mMaxLoadFactor = 0.0f;							// Largest mSize / mNumBuckets before the table doubles (0 never grows)
+	bool mIncrementalRehash = false;						// Move pairs to a bigger table a few buckets at a time
+	std::list<Pair>* mOldTable = nullptr;					// The table being moved out of during an incremental rehash
+	size_t mOldNumBuckets = 0;								// Number of elements in mOldTable
+	size_t mRehashIndex = 0;								// Next bucket of mOldTable to move
+	static const size_t mRehashStep = 4;					// Buckets moved per operation during an incremental rehash
+	static const size_t mDefaultNumBuckets = 16;			// Buckets allocated by an Insert into a dictionary with none
+
 
 public:
 
 	// Constructor
 	// In:	_numBuckets			The number of elements to allocate
+	//							(0 allocates nothing, the first Insert makes the table)
 	//		_hashFunc			The hashing function to be used
 	Dictionary(size_t _numBuckets, unsigned int (*_hashFunc)(const Key&)) {
 		this->mNumBuckets = _numBuckets;
 		this->mHashFunc = _hashFunc;
 
-		this->mTable = new std::list<Pair>[this->mNumBuckets];
+		this->mTable = this->mNumBuckets != 0 ? new std::list<Pair>[this->mNumBuckets] : NULL;
 	}
 
 	// Destructor
@@ -129,12 +144,15 @@ public:
 	Dictionary& operator=(const Dictionary& _assign) {
 		if (this != &_assign)
 		{
+			// Free the old table by hand (calling the destructor here would end this object's lifetime)
 			if (this->mTable != NULL)
 			{
-				this->~Dictionary();
+				this->Clear();
+				delete[] this->mTable;
 			}
+			this->mNumBuckets = 0;
 
-			this->mTable = new std::list<Pair>[_assign.mNumBuckets];
+			this->mTable = _assign.mNumBuckets != 0 ? new std::list<Pair>[_assign.mNumBuckets] : NULL;
 			this->mHashFunc = _assign.mHashFunc;
 
 			for (size_t i = 0; i < _assign.mNumBuckets; ++i)
@@ -148,21 +166,131 @@ public:
 
 				++this->mNumBuckets;
 			}
+
+			// Pairs the other dictionary has not moved to its new table yet go straight into ours
+			for (size_t i = _assign.mRehashIndex; i < _assign.mOldNumBuckets; ++i)
+			{
+				std::list<Pair>* bucket = (_assign.mOldTable + i);
+
+				for (auto it = bucket->begin(); it != bucket->end(); ++it)
+				{
+					this->mTable[this->mHashFunc(it->key) % this->mNumBuckets].push_back(*it);
+				}
+			}
+
+			this->mSize = _assign.mSize;
+			this->mMaxLoadFactor = _assign.mMaxLoadFactor;
+			this->mIncrementalRehash = _assign.mIncrementalRehash;
+		}
+
+		return *this;
+	}
+
+	// Move constructor
+	//		Takes over the table of another object without copying it
+	// In:	_move				The object to move from (left with no buckets, the next Insert makes new ones)
+	Dictionary(Dictionary&& _move) noexcept {
+		this->mTable = _move.mTable;
+		this->mNumBuckets = _move.mNumBuckets;
+		this->mHashFunc = _move.mHashFunc;
+		this->TakeGrowthState(_move);
+
+		_move.mTable = NULL;
+		_move.mNumBuckets = 0;
+	}
+
+	// Move assignment operator
+	//		Takes over the table of another object without copying it
+	// In:	_assign				The object to move from (left with no buckets, the next Insert makes new ones)
+	//
+	// Return: The invoking object (by reference)
+	Dictionary& operator=(Dictionary&& _assign) noexcept {
+		if (this != &_assign)
+		{
+			this->Clear();
+			delete[] this->mTable;
+
+			this->mTable = _assign.mTable;
+			this->mNumBuckets = _assign.mNumBuckets;
+			this->mHashFunc = _assign.mHashFunc;
+			this->TakeGrowthState(_assign);
+
+			_assign.mTable = NULL;
+			_assign.mNumBuckets = 0;
 		}
 
 		return *this;
 	}
 
+	// Exchange the contents of two dictionaries
+	// In:	_other				The dictionary to swap with
+	void Swap(Dictionary& _other) noexcept {
+		std::swap(this->mTable, _other.mTable);
+		std::swap(this->mNumBuckets, _other.mNumBuckets);
+		std::swap(this->mHashFunc, _other.mHashFunc);
+		std::swap(this->mSize, _other.mSize);
+		std::swap(this->mMaxLoadFactor, _other.mMaxLoadFactor);
+		std::swap(this->mIncrementalRehash, _other.mIncrementalRehash);
+		std::swap(this->mOldTable, _other.mOldTable);
+		std::swap(this->mOldNumBuckets, _other.mOldNumBuckets);
+		std::swap(this->mRehashIndex, _other.mRehashIndex);
+	}
+
+	// Exchange the contents of two dictionaries (found by std::swap-style calls)
+	friend void swap(Dictionary& _a, Dictionary& _b) noexcept {
+		_a.Swap(_b);
+	}
+
+	// Return: The number of pairs stored
+	size_t Size() const {
+		return this->mSize;
+	}
+
+	// Return: The average number of pairs per bucket
+	float LoadFactor() const {
+		return this->mNumBuckets != 0 ? (float)this->mSize / (float)this->mNumBuckets : 0.0f;
+	}
+
+	// Set the load factor the table doubles at
+	//		The table starts out fixed at the size it was made with (a max load factor of 0)
+	//		NOTE:	Growing takes every pair's bucket as mHashFunc(key) % mNumBuckets,
+	//				so the hash function has to return more than just a bucket number
+	//				for a bigger table to spread the pairs out
+	//
+	// In:	_maxLoadFactor		The new max load factor (0 to never grow, otherwise clamped to 0.25 - 8)
+	void SetMaxLoadFactor(float _maxLoadFactor) {
+		if (!(_maxLoadFactor > 0.0f))
+			this->mMaxLoadFactor = 0.0f;
+		else
+			this->mMaxLoadFactor = _maxLoadFactor < 0.25f ? 0.25f : (_maxLoadFactor > 8.0f ? 8.0f : _maxLoadFactor);
+		this->GrowIfNeeded();
+	}
+
+	// Choose how the pairs get moved when the table grows
+	//		All at once (the default), or a few buckets at a time by each later
+	//		Insert, Find and Remove, so no single call has to move every pair
+	//
+	// In:	_incremental		True to spread the move over later calls
+	void SetIncrementalRehash(bool _incremental) {
+		this->mIncrementalRehash = _incremental;
+		if (!_incremental)
+			this->FinishRehash();
+	}
+
 	// Clear
 	//		Clears all internal data being stored
 	//  NOTE:	Does not delete table or reset hash function
 	void Clear() {
+		this->FinishRehash();
+
 		for (size_t i = 0; i < this->mNumBuckets; ++i)
 		{
 			std::list<Pair>* bucket = (this->mTable + i);
 
 			bucket->clear();
 		}
+
+		this->mSize = 0;
 	}
 
 	// Insert an item into the table
@@ -170,14 +298,26 @@ public:
 	//		_value		The value at the key
 	//
 	// NOTE:	If there is already an item at the provided key, overwrite it.
+	//			A dictionary with no buckets (one that has been moved from) gets a new table first
 	void Insert(const Key& _key, const Value& _value) {
-		unsigned int bucketNum = this->mHashFunc(_key);
+		if (this->mNumBuckets == 0)
+		{
+			delete[] this->mTable;
+			this->mTable = new std::list<Pair>[mDefaultNumBuckets];
+			this->mNumBuckets = mDefaultNumBuckets;
+		}
+
+		unsigned int bucketNum = this->BucketFor(this->mHashFunc(_key));
 		std::list<Pair>* bucket = (this->mTable + bucketNum);
 		Pair toInsert{ _key, _value };
+		size_t oldBucketSize = bucket->size();
 		
-		bucket->remove_if([&_key](Pair v) { return v.key == _key; });
+		bucket->remove_if([&_key](const Pair& v) { return v.key == _key; });
+		if (bucket->size() == oldBucketSize)
+			++this->mSize;
 
 		bucket->push_back(toInsert);
+		this->GrowIfNeeded();
 	}
 
 	// Find a value at a specified key
@@ -186,7 +326,10 @@ public:
 	// Return: A const pointer to the value at the searched key
 	// NOTE:		Return a null pointer if key is not present
 	const Value* Find(const Key& _key) {
-		unsigned int bucketNum = this->mHashFunc(_key);
+		if (this->mNumBuckets == 0)
+			return nullptr;
+
+		unsigned int bucketNum = this->BucketFor(this->mHashFunc(_key));
 		std::list<Pair>* bucket = (this->mTable + bucketNum);
 
 		Value* result = nullptr;
@@ -205,14 +348,18 @@ public:
 	// Return: True, if an item was removed
 	bool Remove(const Key& _key) {
 		bool removed = false;
-		unsigned int bucketNum = this->mHashFunc(_key);
+		if (this->mNumBuckets == 0)
+			return removed;
+
+		unsigned int bucketNum = this->BucketFor(this->mHashFunc(_key));
 		std::list<Pair>* bucket = &this->mTable[bucketNum];
 
 		for (auto it = bucket->begin(); it != bucket->end(); ++it)
 		{
 			if (it->key == _key)
 			{
-				bucket->remove(*it);
+				bucket->erase(it);
+				--this->mSize;
 				removed = true;
 				break;
 			}
@@ -220,5 +367,105 @@ public:
 
 		return removed;
 	}
-	
+
+private:
+
+	// Find the bucket for a hash, moving some of the old table over first if a rehash is going on
+	//		The old bucket the hash came from is always moved, so the pair is never left behind in it
+	//
+	// In:	_hash		The result of mHashFunc for the key
+	//
+	// Return: The index into mTable
+	unsigned int BucketFor(unsigned int _hash) {
+		if (this->mOldTable != nullptr)
+		{
+			this->MoveOldBucket(_hash % this->mOldNumBuckets);
+			this->StepRehash();
+		}
+		return (unsigned int)(_hash % this->mNumBuckets);
+	}
+
+	// Double the table once there are more pairs than the max load factor allows
+	//		Waits for an incremental rehash that is still going to finish first
+	void GrowIfNeeded() {
+		if (this->mMaxLoadFactor <= 0.0f || this->mOldTable != nullptr || this->mNumBuckets == 0)
+			return;
+
+		size_t numBuckets = this->mNumBuckets;
+		while ((float)this->mSize > (float)numBuckets * this->mMaxLoadFactor)
+			numBuckets *= 2;
+
+		if (numBuckets != this->mNumBuckets)
+			this->Rehash(numBuckets);
+	}
+
+	// Swap in a bigger table
+	//		The old table's pairs are moved now, or bit by bit for an incremental rehash
+	//
+	// In:	_numBuckets		The number of buckets in the new table
+	void Rehash(size_t _numBuckets) {
+		this->FinishRehash();
+
+		this->mOldTable = this->mTable;
+		this->mOldNumBuckets = this->mNumBuckets;
+		this->mRehashIndex = 0;
+
+		this->mTable = new std::list<Pair>[_numBuckets];
+		this->mNumBuckets = _numBuckets;
+
+		if (!this->mIncrementalRehash)
+			this->FinishRehash();
+	}
+
+	// Relink every node of one old bucket into its new bucket (no pairs are copied)
+	void MoveOldBucket(size_t _index) {
+		std::list<Pair>& oldBucket = this->mOldTable[_index];
+		while (!oldBucket.empty())
+		{
+			std::list<Pair>& newBucket = this->mTable[this->mHashFunc(oldBucket.front().key) % this->mNumBuckets];
+			newBucket.splice(newBucket.end(), oldBucket, oldBucket.begin());
+		}
+	}
+
+	// Move the next few old buckets over, freeing the old table once it is empty
+	void StepRehash() {
+		for (size_t moved = 0; moved < mRehashStep && this->mRehashIndex < this->mOldNumBuckets; ++moved)
+		{
+			this->MoveOldBucket(this->mRehashIndex++);
+		}
+
+		if (this->mRehashIndex == this->mOldNumBuckets)
+			this->FinishRehash();
+	}
+
+	// Move everything left in the old table over and free it
+	void FinishRehash() {
+		if (this->mOldTable == nullptr)
+			return;
+
+		while (this->mRehashIndex < this->mOldNumBuckets)
+		{
+			this->MoveOldBucket(this->mRehashIndex++);
+		}
+
+		delete[] this->mOldTable;
+		this->mOldTable = nullptr;
+		this->mOldNumBuckets = 0;
+		this->mRehashIndex = 0;
+	}
+
+	// Take over the growth settings and any rehash in progress of a dictionary being moved from
+	void TakeGrowthState(Dictionary& _other) {
+		this->mSize = _other.mSize;
+		this->mMaxLoadFactor = _other.mMaxLoadFactor;
+		this->mIncrementalRehash = _other.mIncrementalRehash;
+		this->mOldTable = _other.mOldTable;
+		this->mOldNumBuckets = _other.mOldNumBuckets;
+		this->mRehashIndex = _other.mRehashIndex;
+
+		_other.mSize = 0;
+		_other.mOldTable = nullptr;
+		_other.mOldNumBuckets = 0;
+		_other.mRehashIndex = 0;
+	}
 };
\ No newline at end of file
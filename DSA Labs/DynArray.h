@@ -51,19 +51,88 @@ NOTE: If the unit test is not on, that code will not be compiled!
 #define LAB1_DESTRUCTOR								1
 #define LAB1_ASSIGNMENT_OPERATOR					1
 #define LAB1_COPY_CONSTRUCTOR						1
+#define LAB1_MOVE_SEMANTICS							1
+#define LAB1_ALLOCATORS								1
+#define LAB1_SMALL_ARRAY							1
+#define LAB1_GROWTH_POLICY							1
+#define LAB1_BULK_OPERATIONS						1
+#define LAB1_APPEND_BENCHMARK						0
+#define LAB1_TRIVIAL_COPY_BENCHMARK					0
+#define LAB1_SMALL_ARRAY_BENCHMARK					0
+#define LAB1_GROWTH_BENCHMARK						0
+
+/************/
+/* Includes */
+/************/
+#include <memory>
+#include <utility>
+#include <cstring>
+#include <type_traits>
+#include <memory_resource>
+#include "Allocators.h"
+
+// Growth policies
+//		Decide the new capacity when an array runs out of room
+
+// Doubles the capacity (fewest reallocations, up to 50% unused)
+struct DoublingGrowth {
+	static size_t Grow(size_t _capacity) {
+		return _capacity == 0 ? 1 : _capacity * 2;
+	}
+};
+
+// Grows the capacity by half (less unused memory, and freed blocks can be reused)
+struct HalfGrowth {
+	static size_t Grow(size_t _capacity) {
+		return _capacity < 2 ? _capacity + 1 : _capacity + _capacity / 2;
+	}
+};
+
+// Grows the capacity by a fixed number of elements (at most Chunk unused)
+template<size_t Chunk>
+struct ChunkGrowth {
+	static_assert(Chunk != 0, "ChunkGrowth needs a chunk size of at least 1");
+
+	static size_t Grow(size_t _capacity) {
+		return _capacity + Chunk;
+	}
+};
+
+// Room for elements kept inside the DynArray object itself
+//		Empty when there is no inline capacity
+template<typename Type, size_t Count>
+class InlineStorage {
+	alignas(Type) unsigned char mBuffer[Count * sizeof(Type)];
+
+protected:
+	Type* InlineData() { return reinterpret_cast<Type*>(mBuffer); }
+};
 
-// Our implementation of a vector (simplified)
 template<typename Type>
-class DynArray {
+class InlineStorage<Type, 0> {
+protected:
+	Type* InlineData() { return nullptr; }
+};
+
+// Our implementation of a vector (simplified)
+//		The first InlineCapacity elements are stored inside the object,
+//		and only larger arrays go to the allocator
+//		GrowthPolicy picks the new capacity when the array is full
+template<typename Type, typename Allocator = HeapAllocator<Type>, size_t InlineCapacity = 0,
+	typename GrowthPolicy = DoublingGrowth>
+class DynArray : private InlineStorage<Type, InlineCapacity> {
 
 	// Gives access to test code
 	friend class UnitTests_Lab1;
 
+	using AllocTraits = std::allocator_traits<Allocator>;
+
 	// Data members
 	// NOTE: All values set to -1 for unit test purposes
 	Type* mArray = reinterpret_cast<Type*>(-1);
 	size_t mSize = -1;
 	size_t mCapacity = -1;
+	Allocator mAllocator;		// Where the internal array's memory comes from
 
 public:
 
@@ -71,35 +140,36 @@ public:
 	//		Creates an empty object
 	//
 	// In:	_startingCap		Ann initial size to start the array at
+	//		_allocator			The allocator to get memory from
 	//
 	// Note: Do not allocate any memory if the _startingCap is 0
-	DynArray(size_t _startingCap = 0) {
+	//		 (or if it fits in the inline capacity)
+	DynArray(size_t _startingCap = 0, const Allocator& _allocator = Allocator()) : mAllocator(_allocator) {
 		
-		if (_startingCap != 0)
+		if (_startingCap > InlineCapacity)
 		{
 			mCapacity = _startingCap;
-			mArray = new Type[mCapacity];
+			mArray = Allocate(mCapacity);
 			mSize = 0;
 		}
 		else
 		{
-			mCapacity = _startingCap;
+			mCapacity = InlineCapacity;
 			mSize = 0;
-			mArray = nullptr;
+			mArray = this->InlineData();
 		}
 	};
 
 	// Destructor
 	//		Cleans up all dynamically allocated memory
 	~DynArray() {
-		delete[] mArray;
-		mArray = nullptr;
+		Clear();
 	}
 
 	// Copy constructor
 	//		Used to initialize one object to another
 	// In:	_copy				The object to copy from
-	DynArray(const DynArray& _copy) : DynArray() {
+	DynArray(const DynArray& _copy) : DynArray(0, AllocTraits::select_on_container_copy_construction(_copy.mAllocator)) {
 		*this = _copy;
 	}
 
@@ -112,27 +182,120 @@ public:
 	DynArray& operator=(const DynArray& _assign) {
 		if (this != &_assign)
 		{
-			if (this->mArray != nullptr) { this->~DynArray(); }
-			this->mCapacity = _assign.mCapacity;
-			this->mSize = _assign.mSize;
+			if constexpr (AllocTraits::propagate_on_container_copy_assignment::value)
+			{
+				// Memory has to go back to the allocator it came from
+				if (this->mAllocator != _assign.mAllocator) { this->Clear(); }
+				this->mAllocator = _assign.mAllocator;
+			}
+
+			if (_assign.mCapacity <= InlineCapacity)
+			{
+				// The copy goes in the inline storage, so the old contents have to go first
+				this->Clear();
+				CopyRange(this->mArray, _assign.mArray, _assign.mSize);
+				this->mSize = _assign.mSize;
+			}
+			else
+			{
+				Type* temp = Allocate(_assign.mCapacity);
+
+				try
+				{
+					CopyRange(temp, _assign.mArray, _assign.mSize);
+				}
+				catch (...)
+				{
+					Deallocate(temp, _assign.mCapacity);
+					throw;
+				}
 
-			this->mArray = new Type[mCapacity];
+				this->Release();
+				this->mCapacity = _assign.mCapacity;
+				this->mSize = _assign.mSize;
+				this->mArray = temp;
+			}
+		}
+		return *this;
+	}
+
+	// Move constructor
+	//		Takes over the internal array of another object without copying it
+	//		(elements in inline storage are moved one by one instead)
+	// In:	_move				The object to move from (left empty)
+	DynArray(DynArray&& _move) noexcept(InlineCapacity == 0 || std::is_nothrow_move_constructible_v<Type>)
+		: DynArray(0, _move.mAllocator) {
+		Steal(_move);
+	}
 
-			for (unsigned int i = 0; i < mSize; ++i)
+	// Move assignment operator
+	//		Takes over the internal array of another object without copying it
+	// In:	_assign				The object to move from (left empty)
+	//
+	// Return: The invoking object (by reference)
+	DynArray& operator=(DynArray&& _assign) noexcept(InlineCapacity == 0 &&
+		(AllocTraits::propagate_on_container_move_assignment::value || AllocTraits::is_always_equal::value)) {
+		if (this != &_assign)
+		{
+			if constexpr (AllocTraits::propagate_on_container_move_assignment::value)
+			{
+				this->Clear();
+				this->mAllocator = std::move(_assign.mAllocator);
+				Steal(_assign);
+			}
+			else
 			{
-				mArray[i] = _assign.mArray[i];
+				if (this->mAllocator == _assign.mAllocator)
+				{
+					this->Clear();
+					Steal(_assign);
+				}
+				else
+				{
+					// The memory cannot change allocators, so the elements are copied over
+					*this = static_cast<const DynArray&>(_assign);
+					_assign.Clear();
+				}
 			}
 		}
 		return *this;
 	}
 
+	// Exchange the contents of two objects
+	//		Only swaps pointers, unless elements are in inline storage
+	// In:	_other				The object to swap with
+	void Swap(DynArray& _other) {
+		if constexpr (InlineCapacity == 0)
+		{
+			if constexpr (AllocTraits::propagate_on_container_swap::value)
+			{
+				std::swap(mAllocator, _other.mAllocator);
+			}
+			std::swap(mArray, _other.mArray);
+			std::swap(mSize, _other.mSize);
+			std::swap(mCapacity, _other.mCapacity);
+		}
+		else
+		{
+			DynArray temp(std::move(_other));
+			_other = std::move(*this);
+			*this = std::move(temp);
+		}
+	}
+
+	// Exchange the contents of two objects (found by std::swap-style calls)
+	friend void swap(DynArray& _a, DynArray& _b) {
+		_a.Swap(_b);
+	}
+
 	// Clear
 	//		Cleans up all dynamically allocated memory
 	//		Sets all data members back to default values
 	void Clear() {
 		
-		this->~DynArray();
-		mCapacity = 0;
+		Release();
+		mArray = this->InlineData();
+		mCapacity = InlineCapacity;
 		mSize = 0;
 	}
 
@@ -165,52 +328,399 @@ public:
 	//
 	// In:	_data			The item to be added
 	void Append(const Type& _data) {
-		
+		Emplace(_data);
+	}
+
+	// Add an item to the end of the array by moving it in
+	//		Should resize the array if needed
+	//
+	// In:	_data			The item to be moved in
+	void Append(Type&& _data) {
+		Emplace(std::move(_data));
+	}
+
+	// Construct an item in place at the end of the array
+	//		Should resize the array if needed
+	//
+	// In:	_args			The arguments forwarded to Type's constructor
+	//
+	// Return: The newly constructed item (by reference)
+	template<typename... Args>
+	Type& Emplace(Args&&... _args) {
+
 		if (mSize + 1 > mCapacity)
 		{
-			Reserve();
+			// The new item is built before the old ones move, so that
+			// _args may safely refer to an element of this array
+			size_t newCapacity = GrowthPolicy::Grow(mCapacity);
+			Type* temp = Allocate(newCapacity);
+			bool constructed = false;
+
+			try
+			{
+				AllocTraits::construct(mAllocator, temp + mSize, std::forward<Args>(_args)...);
+				constructed = true;
+				MoveRange(temp, mArray, mSize);
+			}
+			catch (...)
+			{
+				if (constructed) { Destroy(temp + mSize, 1); }
+				Deallocate(temp, newCapacity);
+				throw;
+			}
+
+			Release();
+			mArray = temp;
+			mCapacity = newCapacity;
+		}
+		else
+		{
+			AllocTraits::construct(mAllocator, mArray + mSize, std::forward<Args>(_args)...);
+		}
+
+		return mArray[mSize++];
+	}
+
+	// Add a run of items to the end of the array
+	//		Grows the array at most once
+	//
+	// In:	_first			The first item to add
+	//		_count			The number of items to add
+	void AppendRange(const Type* _first, size_t _count) {
+		Insert(mSize, _first, _first + _count);
+	}
+
+	// Insert a run of items in front of an index
+	//		Grows the array at most once, and shifts the existing items only once
+	//
+	// In:	_index			The index to insert at (mSize to add to the end)
+	//		_first			The first item to insert
+	//		_last			One past the last item to insert
+	// NOTE:	An index past the end of the array inserts nothing
+	void Insert(size_t _index, const Type* _first, const Type* _last) {
+		if (_index > mSize) { return; }
+
+		size_t count = static_cast<size_t>(_last - _first);
+		if (count == 0) { return; }
+
+		if (mSize + count > mCapacity)
+		{
+			size_t newCapacity = GrowthPolicy::Grow(mCapacity);
+			if (newCapacity < mSize + count) { newCapacity = mSize + count; }
+
+			// The new items are copied before the old ones move, so that
+			// the range may safely come from this array
+			Type* temp = Allocate(newCapacity);
+			int stage = 0;
+
+			try
+			{
+				CopyRange(temp + _index, _first, count);
+				++stage;
+				MoveRange(temp, mArray, _index);
+				++stage;
+				MoveRange(temp + _index + count, mArray + _index, mSize - _index);
+			}
+			catch (...)
+			{
+				if (stage > 0) { Destroy(temp + _index, count); }
+				if (stage > 1) { Destroy(temp, _index); }
+				Deallocate(temp, newCapacity);
+				throw;
+			}
+
+			Release();
+			mArray = temp;
+			mCapacity = newCapacity;
 		}
-		if (mSize == 0)
+		else if (_index < mSize && _first < mArray + mSize && mArray < _last)
 		{
-			mArray[0] = _data;
+			// The range is part of what gets shifted, so take a copy of it first
+			DynArray copy(count, mAllocator);
+			copy.AppendRange(_first, count);
+			Insert(_index, copy.mArray, copy.mArray + count);
+			return;
+		}
+		else if constexpr (std::is_trivially_copyable_v<Type>)
+		{
+			std::memmove(mArray + _index + count, mArray + _index, (mSize - _index) * sizeof(Type));
+			std::memcpy(mArray + _index, _first, count * sizeof(Type));
 		}
 		else
 		{
-			mArray[mSize] = _data;
+			// Shift the tail back, moving into the uninitialized end first
+			for (size_t i = mSize; i-- > _index;)
+			{
+				if (i + count >= mSize)
+				{
+					AllocTraits::construct(mAllocator, mArray + i + count, std::move(mArray[i]));
+				}
+				else
+				{
+					mArray[i + count] = std::move(mArray[i]);
+				}
+			}
+
+			for (size_t i = 0; i < count; ++i)
+			{
+				if (_index + i < mSize)
+				{
+					mArray[_index + i] = _first[i];
+				}
+				else
+				{
+					AllocTraits::construct(mAllocator, mArray + _index + i, _first[i]);
+				}
+			}
+		}
+
+		mSize += count;
+	}
+
+	// Remove every item that matches a condition
+	//		Keeps the order of the remaining items, and moves each one at most once
+	//
+	// In:	_pred			Returns true for the items to remove
+	//
+	// Return: The number of items removed
+	template<typename Predicate>
+	size_t EraseIf(Predicate _pred) {
+		size_t kept = 0;
+
+		for (size_t i = 0; i < mSize; ++i)
+		{
+			if (!_pred(mArray[i]))
+			{
+				if (kept != i) { mArray[kept] = std::move(mArray[i]); }
+				++kept;
+			}
 		}
-		++mSize;
+
+		size_t removed = mSize - kept;
+		Destroy(mArray + kept, removed);
+		mSize = kept;
+
+		return removed;
 	}
 
 	// Resizes the internal array, and copies all data over
 	// In: _newCapacity		The new capacity of the array
-	//		NOTE:	If 0 is passed, the array should double in size
+	//		NOTE:	If 0 is passed, the array should grow by the GrowthPolicy (doubles by default)
 	//				If _newCapacity < mCapacity, do nothing
 	//
 	//	SPECIAL CASE: If mCapacity is 0, then it should be set to 1
 	void Reserve(const size_t _newCapacity = 0) {
 		if (_newCapacity < mCapacity && _newCapacity != 0) { return; }
-		
-		else if (_newCapacity == 0)
+
+		size_t newCapacity = mCapacity;
+
+		if (_newCapacity == 0)
 		{
-			mCapacity = mCapacity == 0 ?
-				1
-				: mCapacity * 2;
+			newCapacity = GrowthPolicy::Grow(mCapacity);
 		}
 		
 		else if (_newCapacity > mCapacity)
 		{
-			mCapacity = _newCapacity;
+			newCapacity = _newCapacity;
+		}
+
+		Reallocate(newCapacity);
+	}
+
+	// Resizes the internal array to exactly the requested capacity
+	//		Unlike Reserve, this can also shrink the array
+	//
+	// In: _newCapacity		The new capacity of the array
+	//		NOTE:	The capacity never drops below the current size,
+	//				or below the inline capacity
+	void ReserveExact(size_t _newCapacity) {
+		if (_newCapacity < mSize) { _newCapacity = mSize; }
+
+		if (_newCapacity != mCapacity)
+		{
+			Reallocate(_newCapacity);
+		}
+	}
+
+	// Shrinks the internal array so the capacity matches the size
+	//		An empty array releases its memory entirely
+	void ShrinkToFit() {
+		ReserveExact(mSize);
+	}
+
+private:
+
+	// Get raw, uninitialized storage for a number of elements
+	//		No constructors are run on the storage
+	//
+	// In:	_count			The number of elements to make room for
+	//
+	// Return: The first address of the storage
+	Type* Allocate(size_t _count) {
+		return AllocTraits::allocate(mAllocator, _count);
+	}
+
+	// Release storage obtained from Allocate
+	//		Any elements in it must already be destroyed
+	//		The inline storage is never released
+	//
+	// In:	_storage		The storage to release
+	//		_count			The number of elements it was allocated for
+	void Deallocate(Type* _storage, size_t _count) {
+		if (_storage != nullptr && _storage != this->InlineData())
+		{
+			AllocTraits::deallocate(mAllocator, _storage, _count);
+		}
+	}
+
+	// Destroy a run of elements
+	//
+	// In:	_first			The first element to destroy
+	//		_count			The number of elements to destroy
+	void Destroy(Type* _first, size_t _count) {
+		if constexpr (!std::is_trivially_destructible_v<Type>)
+		{
+			for (size_t i = 0; i < _count; ++i)
+			{
+				AllocTraits::destroy(mAllocator, _first + i);
+			}
+		}
+	}
+
+	// Destroy all elements and release the internal array
+	//		Leaves mArray dangling, so the caller must reassign it
+	void Release() {
+		if (mArray != nullptr)
+		{
+			Destroy(mArray, mSize);
+			Deallocate(mArray, mCapacity);
+		}
+	}
+
+	// Take the contents of another object, which must use an equal allocator
+	//		The invoking object must be empty
+	//
+	// In:	_other			The object to take from (left empty)
+	void Steal(DynArray& _other) {
+		if (_other.mArray == _other.InlineData())
+		{
+			// Inline elements cannot change hands, so move them one at a time
+			MoveRange(mArray, _other.mArray, _other.mSize);
+			mSize = _other.mSize;
+			_other.Clear();
+		}
+		else
+		{
+			mArray = _other.mArray;
+			mSize = _other.mSize;
+			mCapacity = _other.mCapacity;
+
+			_other.mArray = _other.InlineData();
+			_other.mSize = 0;
+			_other.mCapacity = InlineCapacity;
 		}
+	}
 
-		Type* temp = new Type[mCapacity];
+	// Move all elements into a new internal array
+	//		Uses the inline storage when the new capacity fits in it
+	//
+	// In:	_newCapacity	The capacity of the new internal array (must be >= mSize)
+	void Reallocate(size_t _newCapacity) {
+		Type* temp = _newCapacity > InlineCapacity ? Allocate(_newCapacity) : this->InlineData();
+
+		// Already in the inline storage
+		if (temp == mArray) { return; }
 
-		for (unsigned int i = 0; i < mSize; ++i)
+		try
 		{
-			temp[i] = mArray[i];
+			MoveRange(temp, mArray, mSize);
+		}
+		catch (...)
+		{
+			Deallocate(temp, _newCapacity);
+			throw;
 		}
 
-		delete[] mArray;
+		Release();
 		mArray = temp;
-		
+		mCapacity = _newCapacity > InlineCapacity ? _newCapacity : InlineCapacity;
+	}
+
+	// Copy a run of elements into new storage
+	//
+	// In:	_storage		Uninitialized storage with room for at least _count elements
+	//		_first			The first element to copy
+	//		_count			The number of elements to copy
+	void CopyRange(Type* _storage, const Type* _first, size_t _count) {
+		if constexpr (std::is_trivially_copyable_v<Type>)
+		{
+			if (_count != 0)
+			{
+				std::memcpy(_storage, _first, _count * sizeof(Type));
+			}
+		}
+		else
+		{
+			size_t i = 0;
+
+			try
+			{
+				for (; i < _count; ++i)
+				{
+					AllocTraits::construct(mAllocator, _storage + i, _first[i]);
+				}
+			}
+			catch (...)
+			{
+				Destroy(_storage, i);
+				throw;
+			}
+		}
 	}
-};
\ No newline at end of file
+
+	// Move a run of elements into new storage
+	//		Elements are copied instead of moved if their move constructor can throw,
+	//		so the originals are left untouched if this fails
+	//		Trivially copyable elements are moved with a single memcpy
+	//
+	// In:	_storage		Uninitialized storage with room for at least _count elements
+	//		_first			The first element to move
+	//		_count			The number of elements to move
+	void MoveRange(Type* _storage, Type* _first, size_t _count) {
+		if constexpr (std::is_trivially_copyable_v<Type>)
+		{
+			if (_count != 0)
+			{
+				std::memcpy(_storage, _first, _count * sizeof(Type));
+			}
+		}
+		else
+		{
+			size_t i = 0;
+
+			try
+			{
+				for (; i < _count; ++i)
+				{
+					AllocTraits::construct(mAllocator, _storage + i, std::move_if_noexcept(_first[i]));
+				}
+			}
+			catch (...)
+			{
+				Destroy(_storage, i);
+				throw;
+			}
+		}
+	}
+};
+
+// A DynArray that keeps up to N elements inline before using the heap
+template<typename Type, size_t N = 16, typename Allocator = HeapAllocator<Type>,
+	typename GrowthPolicy = DoublingGrowth>
+using SmallDynArray = DynArray<Type, Allocator, N, GrowthPolicy>;
+
+namespace pmr {
+	// A DynArray that gets its memory from a std::pmr::memory_resource
+	template<typename Type>
+	using DynArray = ::DynArray<Type, std::pmr::polymorphic_allocator<Type>>;
+}
\ No newline at end of file
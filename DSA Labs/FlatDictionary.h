@@ -0,0 +1,366 @@
+/*
+File:			FlatDictionary.h
+Author(s):
+	Student: Terry Ellison <ellisonterry4@gmail.com>
+
+Created:		10.18.2026
+Last Modified:	10.18.2026
+Purpose:		A hash-mapped data structure using key/value pairs and open
+				addressing, with the same interface as Dictionary
+*/
+
+// Header protection
+#pragma once
+
+/************/
+/* Includes */
+/************/
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <new>
+#include <utility>
+
+// A hash table that keeps every pair in one flat array (Robin Hood hashing)
+//		Each slot records how far its pair is from the slot it hashed to.
+//		Inserting takes the slot of any pair that is closer to home than the
+//		new one, so every pair stays close to where it hashed to
+//		Removing shifts the pairs after the hole back one slot instead of
+//		leaving a tombstone, so lookups never slow down after removes
+//		The table doubles whenever an insert would go past the max load factor
+template<typename Key, typename Value, typename Hash = std::hash<Key>>
+class FlatDictionary {
+
+	// The objects stored in the hash-table
+	struct Pair {
+		Key key;			// The key for insertion/lookup
+		Value value;		// The data
+	};
+
+	// Data members
+	Pair* mSlots = nullptr;				// The pairs (only slots with a distance are constructed)
+	uint32_t* mDistances = nullptr;		// For each slot, 0 if empty, otherwise 1 + how far the pair is from home
+	size_t mNumBuckets = 0;				// Number of slots (0 or a power of 2)
+	size_t mSize = 0;					// Number of pairs stored
+	float mMaxLoadFactor = 0.875f;		// Largest allowed mSize / mNumBuckets
+	Hash mHash;							// The hashing function to be used
+
+public:
+
+	// Constructor
+	// In:	_numBuckets			The number of slots to start with (rounded up to a power of 2)
+	//		_hash				The hashing function to be used
+	explicit FlatDictionary(size_t _numBuckets = 16, const Hash& _hash = Hash())
+		: mHash(_hash) {
+		Allocate(RoundUpBuckets(_numBuckets));
+	}
+
+	// Destructor
+	//		Cleans up any dynamically allocated memory
+	~FlatDictionary() {
+		Clear();
+		Deallocate();
+	}
+
+	// Copy constructor
+	//		Used to initialize one object to another
+	// In:	_copy				The object to copy from
+	FlatDictionary(const FlatDictionary& _copy)
+		: mMaxLoadFactor(_copy.mMaxLoadFactor), mHash(_copy.mHash) {
+		Allocate(_copy.mNumBuckets);
+		CopySlots(_copy);
+	}
+
+	// Assignment operator
+	//		Used to assign one object to another
+	// In:	_assign				The object to assign from
+	//
+	// Return: The invoking object (by reference)
+	//		This allows us to daisy-chain
+	FlatDictionary& operator=(const FlatDictionary& _assign) {
+		if (this != &_assign)
+		{
+			Clear();
+			if (mNumBuckets != _assign.mNumBuckets)
+			{
+				Deallocate();
+				Allocate(_assign.mNumBuckets);
+			}
+
+			mMaxLoadFactor = _assign.mMaxLoadFactor;
+			mHash = _assign.mHash;
+			CopySlots(_assign);
+		}
+		return *this;
+	}
+
+	// Move constructor
+	//		Takes over the table of another object without copying it
+	// In:	_move				The object to move from (left with no slots)
+	FlatDictionary(FlatDictionary&& _move) noexcept
+		: mHash(_move.mHash) {
+		Swap(_move);
+	}
+
+	// Move assignment operator
+	//		Takes over the table of another object without copying it
+	// In:	_assign				The object to move from (left with no slots)
+	//
+	// Return: The invoking object (by reference)
+	FlatDictionary& operator=(FlatDictionary&& _assign) noexcept {
+		if (this != &_assign)
+		{
+			Clear();
+			Deallocate();
+			Swap(_assign);
+		}
+		return *this;
+	}
+
+	// Exchange the contents of two dictionaries
+	// In:	_other				The dictionary to swap with
+	void Swap(FlatDictionary& _other) noexcept {
+		std::swap(mSlots, _other.mSlots);
+		std::swap(mDistances, _other.mDistances);
+		std::swap(mNumBuckets, _other.mNumBuckets);
+		std::swap(mSize, _other.mSize);
+		std::swap(mMaxLoadFactor, _other.mMaxLoadFactor);
+		std::swap(mHash, _other.mHash);
+	}
+
+	// Exchange the contents of two dictionaries (found by std::swap-style calls)
+	friend void swap(FlatDictionary& _a, FlatDictionary& _b) noexcept {
+		_a.Swap(_b);
+	}
+
+	// Return: The number of pairs stored
+	size_t Size() const {
+		return mSize;
+	}
+
+	// Return: The number of slots in the table
+	size_t BucketCount() const {
+		return mNumBuckets;
+	}
+
+	// Return: The fraction of slots in use
+	float LoadFactor() const {
+		return mNumBuckets != 0 ? (float)mSize / (float)mNumBuckets : 0.0f;
+	}
+
+	// Set the largest fraction of slots that can be in use before the table doubles
+	//
+	// In:	_maxLoadFactor		The new max load factor (clamped to 0.25 - 0.95)
+	void SetMaxLoadFactor(float _maxLoadFactor) {
+		mMaxLoadFactor = _maxLoadFactor < 0.25f ? 0.25f : (_maxLoadFactor > 0.95f ? 0.95f : _maxLoadFactor);
+		Reserve(mSize);
+	}
+
+	// Make sure _count pairs fit without the table growing
+	//
+	// In:	_count				The number of pairs to make room for
+	void Reserve(size_t _count) {
+		size_t buckets = mNumBuckets != 0 ? mNumBuckets : 1;
+		while ((float)_count > (float)buckets * mMaxLoadFactor)
+			buckets *= 2;
+
+		if (buckets != mNumBuckets)
+			Rehash(buckets);
+	}
+
+	// Clear
+	//		Clears all internal data being stored
+	//  NOTE:	Does not free the table or reset the hash function
+	void Clear() {
+		for (size_t i = 0; i < mNumBuckets && mSize != 0; ++i)
+		{
+			if (mDistances[i] != 0)
+			{
+				mSlots[i].~Pair();
+				mDistances[i] = 0;
+				--mSize;
+			}
+		}
+	}
+
+	// Insert an item into the table
+	// In:	_key		The key to add at
+	//		_value		The value at the key
+	//
+	// NOTE:	If there is already an item at the provided key, overwrite it.
+	void Insert(const Key& _key, const Value& _value) {
+		Value* existing = FindSlotValue(_key);
+		if (existing != nullptr)
+		{
+			*existing = _value;
+			return;
+		}
+
+		Reserve(mSize + 1);
+		Place(Pair{ _key, _value });
+	}
+
+	// Find a value at a specified key
+	// In:	_key		The key to search for
+	//
+	// Return: A const pointer to the value at the searched key
+	// NOTE:		Return a null pointer if key is not present
+	const Value* Find(const Key& _key) const {
+		return const_cast<FlatDictionary*>(this)->FindSlotValue(_key);
+	}
+
+	// Remove a value at a specified key
+	// In:	_key		The key to remove
+	//
+	// Return: True, if an item was removed
+	bool Remove(const Key& _key) {
+		size_t index = FindSlot(_key);
+		if (index == mNumBuckets)
+			return false;
+
+		mSlots[index].~Pair();
+		--mSize;
+
+		// Shift the following pairs back until one is already home (or a slot is empty)
+		size_t mask = mNumBuckets - 1;
+		size_t next = (index + 1) & mask;
+		while (mDistances[next] > 1)
+		{
+			::new (&mSlots[index]) Pair(std::move(mSlots[next]));
+			mSlots[next].~Pair();
+			mDistances[index] = mDistances[next] - 1;
+
+			index = next;
+			next = (next + 1) & mask;
+		}
+		mDistances[index] = 0;
+		return true;
+	}
+
+private:
+
+	// Return: The smallest power of 2 that is at least _numBuckets (and at least 2)
+	static size_t RoundUpBuckets(size_t _numBuckets) {
+		size_t buckets = 2;
+		while (buckets < _numBuckets)
+			buckets *= 2;
+		return buckets;
+	}
+
+	// Return: The slot a key hashes to
+	//		The hash is mixed first, so hashes that only differ in their high bits
+	//		(or that are small bucket numbers) still spread over the whole table
+	size_t HomeSlot(const Key& _key) const {
+		uint64_t hash = (uint64_t)mHash(_key);
+		hash ^= hash >> 33;
+		hash *= 0xFF51AFD7ED558CCDull;
+		hash ^= hash >> 33;
+		return (size_t)hash & (mNumBuckets - 1);
+	}
+
+	// Return: The slot holding a key, or mNumBuckets if it is not present
+	size_t FindSlot(const Key& _key) const {
+		if (mSize == 0)
+			return mNumBuckets;
+
+		size_t mask = mNumBuckets - 1;
+		size_t index = HomeSlot(_key);
+		uint32_t distance = 1;
+
+		// Once a pair is closer to home than the key would be, the key can not be further on
+		while (mDistances[index] >= distance)
+		{
+			if (mDistances[index] == distance && mSlots[index].key == _key)
+				return index;
+
+			++distance;
+			index = (index + 1) & mask;
+		}
+		return mNumBuckets;
+	}
+
+	// Return: A pointer to the value at a key, or null if it is not present
+	Value* FindSlotValue(const Key& _key) {
+		size_t index = FindSlot(_key);
+		return index != mNumBuckets ? &mSlots[index].value : nullptr;
+	}
+
+	// Put a pair whose key is not in the table yet into its slot
+	//		Pairs that are closer to home than the one being carried give up their slot
+	//		and are carried on instead
+	void Place(Pair&& _pair) {
+		size_t mask = mNumBuckets - 1;
+		size_t index = HomeSlot(_pair.key);
+		uint32_t distance = 1;
+
+		while (mDistances[index] != 0)
+		{
+			if (mDistances[index] < distance)
+			{
+				std::swap(_pair, mSlots[index]);
+				std::swap(distance, mDistances[index]);
+			}
+
+			++distance;
+			index = (index + 1) & mask;
+		}
+
+		::new (&mSlots[index]) Pair(std::move(_pair));
+		mDistances[index] = distance;
+		++mSize;
+	}
+
+	// Move every pair into a new table with a different number of slots
+	void Rehash(size_t _numBuckets) {
+		Pair* oldSlots = mSlots;
+		uint32_t* oldDistances = mDistances;
+		size_t oldNumBuckets = mNumBuckets;
+
+		Allocate(_numBuckets);
+		mSize = 0;
+
+		for (size_t i = 0; i < oldNumBuckets; ++i)
+		{
+			if (oldDistances[i] != 0)
+			{
+				Place(std::move(oldSlots[i]));
+				oldSlots[i].~Pair();
+			}
+		}
+
+		std::allocator<Pair>().deallocate(oldSlots, oldNumBuckets);
+		delete[] oldDistances;
+	}
+
+	// Copy every pair of another table with the same number of slots into the same slots
+	void CopySlots(const FlatDictionary& _other) {
+		for (size_t i = 0; i < mNumBuckets; ++i)
+		{
+			if (_other.mDistances[i] != 0)
+			{
+				::new (&mSlots[i]) Pair(_other.mSlots[i]);
+				mDistances[i] = _other.mDistances[i];
+			}
+		}
+		mSize = _other.mSize;
+	}
+
+	// Set up an empty table (the pairs are not constructed until used)
+	void Allocate(size_t _numBuckets) {
+		mSlots = std::allocator<Pair>().allocate(_numBuckets);
+		mDistances = new uint32_t[_numBuckets]();
+		mNumBuckets = _numBuckets;
+	}
+
+	// Free an empty table
+	void Deallocate() {
+		if (mSlots != nullptr)
+			std::allocator<Pair>().deallocate(mSlots, mNumBuckets);
+		delete[] mDistances;
+
+		mSlots = nullptr;
+		mDistances = nullptr;
+		mNumBuckets = 0;
+	}
+};
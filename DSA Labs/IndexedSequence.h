@@ -0,0 +1,279 @@
+/*
+File:			IndexedSequence.h
+Author(s):
+	Student: Terry Ellison <ellisonterry4@gmail.com>
+
+Created:		10.18.2026
+Last Modified:	10.18.2026
+Purpose:		A sequence with O(log n) insert, erase and access by index,
+				with the same positional Insert as DSA_Lab4
+*/
+
+// Header protection
+#pragma once
+
+/************/
+/* Includes */
+/************/
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+// A sequence kept in an implicit treap
+//		Each node stores how many nodes are in its subtree, so an index is found
+//		by walking down from the root instead of along the whole sequence
+//		Nodes are never keyed, their order in the tree *is* the sequence order
+//		Random priorities keep the tree balanced (expected depth is O(log n))
+template<typename Type>
+class IndexedSequence {
+
+	friend class UnitTests_Lab4;	// Giving access to test code
+
+	struct Node {
+		Type data;
+		Node* left = nullptr;
+		Node* right = nullptr;
+		unsigned int priority;
+		size_t count = 1;		// Nodes in this subtree, including this one
+
+		Node(const Type& _data, unsigned int _priority)
+			: data(_data), priority(_priority) {
+		}
+	};
+
+	// Data members
+	Node* mRoot = nullptr;
+	unsigned int mSeed = 2463534242u;	// xorshift state for node priorities
+
+public:
+
+	// Default constructor
+	//		Creates a new empty sequence
+	IndexedSequence() = default;
+
+	// Destructor
+	//		Cleans up all dynamically allocated memory
+	~IndexedSequence() {
+		Clear();
+	}
+
+	// Copy constructor
+	//		Used to initialize one object to another
+	// In:	_copy			The object to copy from
+	IndexedSequence(const IndexedSequence& _copy) {
+		*this = _copy;
+	}
+
+	// Assignment operator
+	//		Used to assign one object to another
+	// In:	_assign			The object to assign from
+	//
+	// Return: The invoking object (by reference)
+	//		This allows us to daisy-chain
+	IndexedSequence& operator=(const IndexedSequence& _assign) {
+		if (this != &_assign)
+		{
+			Clear();
+			mRoot = CopyTree(_assign.mRoot);
+			mSeed = _assign.mSeed;
+		}
+		return *this;
+	}
+
+	// Return: The number of values in the sequence
+	size_t Size() const {
+		return Count(mRoot);
+	}
+
+	// Remove every value
+	//		Walks the tree with an explicit stack, so any depth is safe
+	void Clear() {
+		if (mRoot == nullptr)
+			return;
+
+		std::vector<Node*> pending;
+		pending.push_back(mRoot);
+		while (!pending.empty())
+		{
+			Node* node = pending.back();
+			pending.pop_back();
+			if (node->left != nullptr)
+				pending.push_back(node->left);
+			if (node->right != nullptr)
+				pending.push_back(node->right);
+			delete node;
+		}
+		mRoot = nullptr;
+	}
+
+	// Insert a value _index values away from the front
+	//		If _index is 0 - insert in front of the first value
+	//		If _index is Size() - add to the end
+	//
+	// In:	_index		The "index" to add at
+	//		_val		The value to insert
+	void Insert(int _index, const Type& _val) {
+		Node* left;
+		Node* right;
+		Split(mRoot, (size_t)_index, left, right);
+		mRoot = Merge(Merge(left, new Node(_val, NextPriority())), right);
+	}
+
+	// Remove the value _index values away from the front
+	//
+	// In:	_index		The "index" of the value to remove (must be < Size())
+	void Erase(int _index) {
+		size_t index = (size_t)_index;
+		Node** link = &mRoot;
+
+		// Every subtree on the way down loses one node
+		while (true)
+		{
+			Node* node = *link;
+			size_t leftCount = Count(node->left);
+
+			if (index == leftCount)
+			{
+				*link = Merge(node->left, node->right);
+				delete node;
+				return;
+			}
+
+			--node->count;
+			if (index < leftCount)
+				link = &node->left;
+			else
+			{
+				index -= leftCount + 1;
+				link = &node->right;
+			}
+		}
+	}
+
+	// Access a value by its index
+	//
+	// In:	_index		The "index" of the value (must be < Size())
+	//
+	// Return: The value at that index (by reference)
+	Type& operator[](int _index) {
+		return Find((size_t)_index)->data;
+	}
+	const Type& operator[](int _index) const {
+		return Find((size_t)_index)->data;
+	}
+
+	// Copy every value out in sequence order
+	//
+	// In:	_out		Receives Size() values
+	void CopyTo(Type* _out) const {
+		std::vector<const Node*> pending;
+		const Node* node = mRoot;
+		while (node != nullptr || !pending.empty())
+		{
+			while (node != nullptr)
+			{
+				pending.push_back(node);
+				node = node->left;
+			}
+			node = pending.back();
+			pending.pop_back();
+			*_out++ = node->data;
+			node = node->right;
+		}
+	}
+
+private:
+
+	// Return: The number of nodes in a subtree (0 for null)
+	static size_t Count(const Node* _node) {
+		return _node != nullptr ? _node->count : 0;
+	}
+
+	// Return: A new random priority
+	unsigned int NextPriority() {
+		mSeed ^= mSeed << 13;
+		mSeed ^= mSeed >> 17;
+		mSeed ^= mSeed << 5;
+		return mSeed;
+	}
+
+	// Find the node at an index
+	Node* Find(size_t _index) const {
+		Node* node = mRoot;
+		while (true)
+		{
+			size_t leftCount = Count(node->left);
+			if (_index == leftCount)
+				return node;
+
+			if (_index < leftCount)
+				node = node->left;
+			else
+			{
+				_index -= leftCount + 1;
+				node = node->right;
+			}
+		}
+	}
+
+	// Split a subtree into its first _count nodes and the rest
+	//
+	// In:	_node		The subtree to split
+	//		_count		The number of nodes to put in _left
+	//		_left		Receives the first _count nodes
+	//		_right		Receives the rest
+	static void Split(Node* _node, size_t _count, Node*& _left, Node*& _right) {
+		if (_node == nullptr)
+		{
+			_left = nullptr;
+			_right = nullptr;
+			return;
+		}
+
+		size_t leftCount = Count(_node->left);
+		if (_count <= leftCount)
+		{
+			Split(_node->left, _count, _left, _node->left);
+			_right = _node;
+		}
+		else
+		{
+			Split(_node->right, _count - leftCount - 1, _node->right, _right);
+			_left = _node;
+		}
+		_node->count = Count(_node->left) + Count(_node->right) + 1;
+	}
+
+	// Join two subtrees, every node of _left coming before every node of _right
+	//
+	// Return: The root of the joined subtree
+	static Node* Merge(Node* _left, Node* _right) {
+		if (_left == nullptr)
+			return _right;
+		if (_right == nullptr)
+			return _left;
+
+		if (_left->priority > _right->priority)
+		{
+			_left->right = Merge(_left->right, _right);
+			_left->count = Count(_left->left) + Count(_left->right) + 1;
+			return _left;
+		}
+
+		_right->left = Merge(_left, _right->left);
+		_right->count = Count(_right->left) + Count(_right->right) + 1;
+		return _right;
+	}
+
+	// Copy a subtree, keeping its shape and priorities
+	static Node* CopyTree(const Node* _node) {
+		if (_node == nullptr)
+			return nullptr;
+
+		Node* copy = new Node(_node->data, _node->priority);
+		copy->count = _node->count;
+		copy->left = CopyTree(_node->left);
+		copy->right = CopyTree(_node->right);
+		return copy;
+	}
+};
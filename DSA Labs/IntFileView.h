@@ -0,0 +1,226 @@
+/*
+File:			IntFileView.h
+Author(s):
+	Student: Terry Ellison <ellisonterry4@gmail.com>
+
+Created:		10.18.2026
+Last Modified:	10.18.2026
+Purpose:		A read-only, memory-mapped view of a binary integer file
+				(the same layout DSA_Lab2::Fill reads)
+*/
+
+// Header protection
+#pragma once
+
+/************/
+/* Includes */
+/************/
+#include <cstddef>
+#include "Lab2.h"
+#include "IntSearch.h"
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Maps a binary integer file into memory and exposes its ints without copying them
+//		First four bytes of the file are the number of ints in the file
+//		The ints are read straight from the mapped pages, so nothing is loaded up front
+class IntFileView {
+
+	// Data members
+	const char* mBase = nullptr;	// Start of the mapped file
+	size_t mLength = 0;				// Number of bytes mapped
+	const int* mData = nullptr;		// First int after the header
+	size_t mSize = 0;				// Number of ints in the view
+
+#ifdef _WIN32
+	HANDLE mFile = INVALID_HANDLE_VALUE;
+	HANDLE mMapping = NULL;
+#endif
+
+public:
+
+	// Default constructor
+	//		Creates a view of nothing
+	IntFileView() = default;
+
+	// Constructor
+	//		Maps a file right away
+	//
+	// In:	_input		Name of the file to map
+	explicit IntFileView(const char* _input) {
+		Open(_input);
+	}
+
+	// Destructor
+	//		Unmaps the file
+	~IntFileView() {
+		Close();
+	}
+
+	IntFileView(const IntFileView&) = delete;
+	IntFileView& operator=(const IntFileView&) = delete;
+
+	// Map a file, replacing whatever the view was showing
+	//
+	// In:	_input		Name of the file to map
+	//
+	// Return: True, if the file was mapped
+	// NOTE:	A negative count shows no ints, and a count larger than the
+	//			file only shows the ints that are fully present
+	bool Open(const char* _input) {
+		Close();
+
+#ifdef _WIN32
+		mFile = CreateFileA(_input, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+			FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+		if (mFile == INVALID_HANDLE_VALUE)
+			return false;
+
+		LARGE_INTEGER fileSize;
+		if (!GetFileSizeEx(mFile, &fileSize) || fileSize.QuadPart < (LONGLONG)sizeof(int))
+		{
+			Close();
+			return false;
+		}
+
+		mMapping = CreateFileMappingA(mFile, NULL, PAGE_READONLY, 0, 0, NULL);
+		if (mMapping == NULL)
+		{
+			Close();
+			return false;
+		}
+
+		mBase = static_cast<const char*>(MapViewOfFile(mMapping, FILE_MAP_READ, 0, 0, 0));
+		if (mBase == nullptr)
+		{
+			Close();
+			return false;
+		}
+		mLength = (size_t)fileSize.QuadPart;
+#else
+		int file = open(_input, O_RDONLY);
+		if (file == -1)
+			return false;
+
+		struct stat info;
+		if (fstat(file, &info) != 0 || info.st_size < (off_t)sizeof(int))
+		{
+			close(file);
+			return false;
+		}
+
+		void* base = mmap(nullptr, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+		close(file);
+		if (base == MAP_FAILED)
+			return false;
+
+		mBase = static_cast<const char*>(base);
+		mLength = (size_t)info.st_size;
+#endif
+
+		int count = *reinterpret_cast<const int*>(mBase);
+		size_t available = (mLength - sizeof(int)) / sizeof(int);
+
+		mData = reinterpret_cast<const int*>(mBase + sizeof(int));
+		mSize = count <= 0 ? 0 : ((size_t)count < available ? (size_t)count : available);
+		return true;
+	}
+
+	// Unmap the file
+	//		The view is empty afterwards
+	void Close() {
+#ifdef _WIN32
+		if (mBase != nullptr)
+			UnmapViewOfFile(mBase);
+		if (mMapping != NULL)
+			CloseHandle(mMapping);
+		if (mFile != INVALID_HANDLE_VALUE)
+			CloseHandle(mFile);
+		mMapping = NULL;
+		mFile = INVALID_HANDLE_VALUE;
+#else
+		if (mBase != nullptr)
+			munmap(const_cast<char*>(mBase), mLength);
+#endif
+		mBase = nullptr;
+		mLength = 0;
+		mData = nullptr;
+		mSize = 0;
+	}
+
+	// Return: True, if a file is mapped
+	bool IsOpen() const {
+		return mBase != nullptr;
+	}
+
+	// Return: The first int of the payload
+	const int* Data() const {
+		return mData;
+	}
+
+	// Return: The number of ints in the view
+	size_t Size() const {
+		return mSize;
+	}
+
+	const int* begin() const {
+		return mData;
+	}
+
+	const int* end() const {
+		return mData + mSize;
+	}
+
+	// Get an individual int from the view
+	int operator[](size_t _index) const {
+		return mData[_index];
+	}
+
+	// Determine if a value is present in the file
+	//
+	// In:	_val		The value to find
+	//
+	// Return: True, if the value is present
+	bool Contains(int _val) const {
+		return ScanForInt(mData, mSize, _val);
+	}
+
+	// Count how many times a value appears in the file
+	//
+	// In:	_val		The value to count
+	//
+	// Return: The number of matches
+	size_t Count(int _val) const {
+		size_t count = 0;
+		for (size_t i = 0; i < mSize; ++i)
+		{
+			count += mData[i] == _val;
+		}
+		return count;
+	}
+
+	// Count the palindrome numbers in the file
+	//
+	// Return: The number of palindromes
+	size_t CountPalindromes() const {
+		size_t count = 0;
+		for (size_t i = 0; i < mSize; ++i)
+		{
+			count += IsPalindromeNumber(mData[i]);
+		}
+		return count;
+	}
+};
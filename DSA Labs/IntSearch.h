@@ -0,0 +1,185 @@
+/*
+File:			IntSearch.h
+Author(s):
+	Student: Terry Ellison <ellisonterry4@gmail.com>
+
+Created:		10.18.2026
+Last Modified:	10.18.2026
+Purpose:		Fast membership tests over arrays of ints
+				(vectorized scans, and an Eytzinger search index for repeated queries)
+*/
+
+// Header protection
+#pragma once
+
+/************/
+/* Includes */
+/************/
+#include <cstddef>
+#include <vector>
+#include <algorithm>
+#include "CpuFeatures.h"
+
+// Signature shared by every scan kernel
+//
+// In:	_values		The ints to look through
+//		_count		The number of ints
+//		_val		The value to find
+//
+// Return: True, if the value is present
+using IntScanKernel = bool(*)(const int* _values, size_t _count, int _val);
+
+// Reference kernel, one int at a time
+inline bool ScanForIntScalar(const int* _values, size_t _count, int _val) {
+	for (size_t i = 0; i < _count; ++i)
+	{
+		if (_values[i] == _val)
+			return true;
+	}
+	return false;
+}
+
+#if SIMD_X86
+
+// Compares four ints per step and stops at the first block with a match
+SIMD_TARGET("sse2")
+inline bool ScanForIntSSE2(const int* _values, size_t _count, int _val) {
+	const __m128i target = _mm_set1_epi32(_val);
+
+	size_t i = 0;
+	for (; i + 4 <= _count; i += 4)
+	{
+		__m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_values + i));
+		if (_mm_movemask_epi8(_mm_cmpeq_epi32(block, target)) != 0)
+			return true;
+	}
+
+	return ScanForIntScalar(_values + i, _count - i, _val);
+}
+
+// Compares eight ints per step and stops at the first block with a match
+SIMD_TARGET("avx2")
+inline bool ScanForIntAVX2(const int* _values, size_t _count, int _val) {
+	const __m256i target = _mm256_set1_epi32(_val);
+
+	size_t i = 0;
+	for (; i + 8 <= _count; i += 8)
+	{
+		__m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_values + i));
+		if (_mm256_movemask_epi8(_mm256_cmpeq_epi32(block, target)) != 0)
+			return true;
+	}
+
+	return ScanForIntScalar(_values + i, _count - i, _val);
+}
+
+#endif
+
+// Pick the fastest scan kernel the CPU running the program supports
+//
+// Return: The kernel to use
+inline IntScanKernel SelectIntScanKernel() {
+#if SIMD_X86
+	const CpuFeatures& cpu = GetCpuFeatures();
+
+	if (cpu.avx2)
+		return ScanForIntAVX2;
+	if (cpu.sse2)
+		return ScanForIntSSE2;
+#endif
+
+	return ScanForIntScalar;
+}
+
+// Determine if a value is present in an unsorted array
+//		The kernel is picked the first time this is called
+//
+// In:	_values		The ints to look through
+//		_count		The number of ints
+//		_val		The value to find
+//
+// Return: True, if the value is present
+inline bool ScanForInt(const int* _values, size_t _count, int _val) {
+	static const IntScanKernel kernel = SelectIntScanKernel();
+	return kernel(_values, _count, _val);
+}
+
+// A sorted copy of a set of ints, stored in Eytzinger (breadth-first heap) order
+//		Node k has its children at 2k and 2k + 1, so every level of the search
+//		reads from one small, predictable region of memory instead of jumping
+//		around the array like a normal binary search
+class EytzingerIndex {
+
+	std::vector<int> mTree;		// mTree[0] is unused, the root is at mTree[1]
+
+public:
+
+	// Build the index from unsorted values
+	//		Duplicates are removed, they can not change the answer to Contains
+	//
+	// In:	_values		The ints to index
+	//		_count		The number of ints
+	void Build(const int* _values, size_t _count) {
+		std::vector<int> sorted(_values, _values + _count);
+		std::sort(sorted.begin(), sorted.end());
+		sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+
+		mTree.assign(sorted.size() + 1, 0);
+
+		// An in-order walk of the implicit tree visits the nodes in sorted order
+		size_t next = 0, node = 1;
+		std::vector<size_t> path;
+		while (node < mTree.size() || !path.empty())
+		{
+			if (node < mTree.size())
+			{
+				path.push_back(node);
+				node *= 2;
+			}
+			else
+			{
+				node = path.back();
+				path.pop_back();
+				mTree[node] = sorted[next++];
+				node = node * 2 + 1;
+			}
+		}
+	}
+
+	// Empty the index and release its memory
+	void Clear() {
+		mTree.clear();
+		mTree.shrink_to_fit();
+	}
+
+	// Return: The number of distinct values in the index
+	size_t Size() const {
+		return mTree.empty() ? 0 : mTree.size() - 1;
+	}
+
+	// Determine if a value is in the index
+	//
+	// In:	_val		The value to find
+	//
+	// Return: True, if the value is present
+	bool Contains(int _val) const {
+		size_t count = Size();
+		size_t node = 1;
+
+		// Walk to the bottom without branching on the comparison
+		while (node <= count)
+		{
+			node = 2 * node + (mTree[node] < _val);
+		}
+
+		// Every right turn after the last left turn added a trailing 1 bit,
+		// dropping those (and the left turn) gives the smallest value >= _val
+		while (node & 1)
+		{
+			node >>= 1;
+		}
+		node >>= 1;
+
+		return node != 0 && mTree[node] == _val;
+	}
+};
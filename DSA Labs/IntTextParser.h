@@ -0,0 +1,199 @@
+/*
+File:			IntTextParser.h
+Author(s):
+	Student: Terry Ellison <ellisonterry4@gmail.com>
+
+Created:		10.18.2026
+Last Modified:	10.18.2026
+Purpose:		Fast parsing of whitespace separated integer text files
+				(like numbers.txt) and conversion to the binary format
+				DSA_Lab2::Fill reads
+*/
+
+// Header protection
+#pragma once
+
+/************/
+/* Includes */
+/************/
+#include <charconv>
+#include <climits>
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <thread>
+#include <vector>
+
+// Parse every int in a block of text and add them to the end of a vector
+//		Ints can be separated by any mix of spaces, tabs and newlines
+//
+// In:	_first		The first character of the text
+//		_last		One past the last character of the text
+//		_out		Receives the ints
+//
+// Return: True, if every token was an int (the ints before a bad token are kept)
+// NOTE:	Like ifstream >> int, a single leading '+' is allowed ("+5" is 5, "+-5" is bad)
+inline bool ParseIntRange(const char* _first, const char* _last, std::vector<int>& _out) {
+	while (true)
+	{
+		while (_first != _last && (*_first == ' ' || *_first == '\n' || *_first == '\r' || *_first == '\t'))
+			++_first;
+
+		if (_first == _last)
+			return true;
+
+		// from_chars only takes a '-' sign
+		if (*_first == '+')
+		{
+			++_first;
+			if (_first == _last || *_first == '-')
+				return false;
+		}
+
+		int value;
+		std::from_chars_result result = std::from_chars(_first, _last, value);
+		if (result.ec != std::errc())
+			return false;
+
+		_out.push_back(value);
+		_first = result.ptr;
+	}
+}
+
+// Parse an integer text file and add the ints to the end of a vector
+//		With one thread, the file is streamed through a fixed size buffer
+//		With more, the whole file is read at once and split at newlines,
+//		each thread parses its own part and the parts are joined in order
+//
+// In:	_input		Name of the file to open
+//		_out		Receives the ints
+//		_threads	The number of threads to parse with (0 uses one per core)
+//
+// Return: True, if the file was opened and every token was an int
+inline bool ParseIntText(const char* _input, std::vector<int>& _out, unsigned int _threads = 1) {
+	std::ifstream inputFile(_input, std::ios::in | std::ios::binary);
+	if (!inputFile.is_open())
+		return false;
+
+	if (_threads == 0)
+		_threads = std::thread::hardware_concurrency() ? std::thread::hardware_concurrency() : 1;
+
+	if (_threads == 1)
+	{
+		const size_t bufferSize = 1 << 20;
+		std::vector<char> buffer(bufferSize);
+		size_t carried = 0;		// Characters of a split token left at the front of the buffer
+
+		while (true)
+		{
+			inputFile.read(buffer.data() + carried, (std::streamsize)(bufferSize - carried));
+			size_t filled = carried + (size_t)inputFile.gcount();
+			bool done = filled < bufferSize;
+
+			// Only parse up to the last separator, the rest may be the start of a token
+			size_t end = filled;
+			if (!done)
+			{
+				while (end != 0 && buffer[end - 1] != '\n' && buffer[end - 1] != ' ' &&
+					buffer[end - 1] != '\r' && buffer[end - 1] != '\t')
+					--end;
+
+				// A buffer with no separator at all can not be an int
+				if (end == 0)
+					return false;
+			}
+
+			if (!ParseIntRange(buffer.data(), buffer.data() + end, _out))
+				return false;
+
+			if (done)
+				return true;
+
+			carried = filled - end;
+			std::memmove(buffer.data(), buffer.data() + end, carried);
+		}
+	}
+
+	inputFile.seekg(0, std::ios::end);
+	size_t length = (size_t)(std::streamoff)inputFile.tellg();
+	inputFile.seekg(0, std::ios::beg);
+
+	std::vector<char> text(length);
+	inputFile.read(text.data(), (std::streamsize)length);
+	length = (size_t)inputFile.gcount();
+
+	// Split into roughly equal parts, moving each split forward to the next newline
+	std::vector<size_t> splits(_threads + 1, length);
+	splits[0] = 0;
+	for (unsigned int part = 1; part < _threads; ++part)
+	{
+		size_t split = length / _threads * part;
+		if (split < splits[part - 1])
+			split = splits[part - 1];
+		while (split < length && text[split] != '\n')
+			++split;
+		splits[part] = split;
+	}
+
+	std::vector<std::vector<int>> parts(_threads);
+	std::vector<char> succeeded(_threads, 0);
+	std::vector<std::thread> workers;
+	for (unsigned int part = 0; part < _threads; ++part)
+	{
+		workers.emplace_back([&, part]()
+		{
+			parts[part].reserve((splits[part + 1] - splits[part]) / 4);
+			succeeded[part] = ParseIntRange(text.data() + splits[part], text.data() + splits[part + 1], parts[part]);
+		});
+	}
+	for (std::thread& worker : workers)
+	{
+		worker.join();
+	}
+
+	// Keep everything up to the first part with a bad token, the same as the single thread path
+	for (unsigned int part = 0; part < _threads; ++part)
+	{
+		_out.insert(_out.end(), parts[part].begin(), parts[part].end());
+		if (!succeeded[part])
+			return false;
+	}
+	return true;
+}
+
+// Write ints in the binary format DSA_Lab2::Fill reads
+//		First four bytes are the number of ints, the ints follow
+//
+// In:	_output		Name of the file to create
+//		_values		The ints to write
+//		_count		The number of ints
+//
+// Return: True, if the file was written
+inline bool WriteIntBinary(const char* _output, const int* _values, size_t _count) {
+	if (_count > (size_t)INT_MAX)
+		return false;
+
+	std::ofstream outputFile(_output, std::ios::out | std::ios::binary | std::ios::trunc);
+	if (!outputFile.is_open())
+		return false;
+
+	int count = (int)_count;
+	outputFile.write((const char*)&count, sizeof(int));
+	outputFile.write((const char*)_values, (std::streamsize)(_count * sizeof(int)));
+	return (bool)outputFile;
+}
+
+// Convert an integer text file into the binary format DSA_Lab2::Fill reads
+//
+// In:	_input		Name of the text file
+//		_output		Name of the binary file to create
+//		_threads	The number of threads to parse with (0 uses one per core)
+//
+// Return: True, if the text was fully parsed and the binary file was written
+inline bool ConvertIntTextToBinary(const char* _input, const char* _output, unsigned int _threads = 1) {
+	std::vector<int> values;
+	if (!ParseIntText(_input, values, _threads))
+		return false;
+
+	return WriteIntBinary(_output, values.data(), values.size());
+}
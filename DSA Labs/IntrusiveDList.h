@@ -0,0 +1,310 @@
+/*
+File:			IntrusiveDList.h
+Author(s):
+	Student: Terry Ellison <ellisonterry4@gmail.com>
+
+Created:		10.18.2026
+Last Modified:	10.18.2026
+Purpose:		A doubly-linked list that links objects through a hook stored
+				inside them, with the same interface as DList
+*/
+
+// Header protection
+#pragma once
+
+/************/
+/* Includes */
+/************/
+#include <cstddef>
+#include <utility>
+
+// The links an object needs to be put in an IntrusiveDList
+//		Add one as a member for every list the object can be in at the same time
+template<typename Type>
+struct IntrusiveListHook {
+	Type* next = nullptr;
+	Type* prev = nullptr;
+};
+
+// A doubly-linked list of objects the list does not own
+//		The links live in the objects themselves (the Hook member), so adding
+//		and removing never allocates and never copies an object
+//		The objects have to outlive their time in the list, and an object can
+//		only be in one list per hook
+//
+// Example:
+//		struct Job { int id; IntrusiveListHook<Job> hook; };
+//		IntrusiveDList<Job, &Job::hook> queue;
+template<typename Type, IntrusiveListHook<Type> Type::*Hook>
+class IntrusiveDList {
+
+	// Return: The hook of an object
+	static IntrusiveListHook<Type>& HookOf(Type* _object) {
+		return _object->*Hook;
+	}
+
+public:
+
+	class Iterator {
+	public:
+
+		Type* mCurr = nullptr;		// Current object (null at the end)
+
+		// Pre-fix increment operator
+		//
+		// Return: Invoking object pointing at the next object
+		Iterator& operator++() {
+			mCurr = HookOf(mCurr).next;
+			return *this;
+		}
+
+		// Post-fix increment operator
+		//
+		// In:	(unused)		Post-fix operators take in an unused int, so that the compiler can differentiate
+		//
+		// Return:	An iterator pointing at the "old" object
+		Iterator operator++(int) {
+			Iterator val = *this;
+			mCurr = HookOf(mCurr).next;
+			return val;
+		}
+
+		// Pre-fix decrement operator
+		//
+		// Return: Invoking object pointing at the previous object
+		Iterator& operator--() {
+			mCurr = HookOf(mCurr).prev;
+			return *this;
+		}
+
+		// Post-fix decrement operator
+		//
+		// In:	(unused)		Post-fix operators take in an unused int, so that the compiler can differentiate
+		//
+		// Return:	An iterator pointing at the "old" object
+		Iterator operator--(int) {
+			Iterator val = *this;
+			mCurr = HookOf(mCurr).prev;
+			return val;
+		}
+
+		// Dereference operator
+		//
+		// Return: The object the iterator is pointing to
+		Type& operator*() {
+			return *mCurr;
+		}
+
+		// Not-equal operator
+		//
+		// In:	_iter		The iterator to compare against
+		//
+		// Return: True, if the iterators are not pointing to the same object
+		bool operator != (const Iterator& _iter) const {
+			return mCurr != _iter.mCurr;
+		}
+	};
+
+private:
+
+	// Data members
+	Type* mHead = nullptr;
+	Type* mTail = nullptr;
+	size_t mSize = 0;
+
+public:
+
+	// Default constructor
+	//		Creates a new empty list
+	IntrusiveDList() = default;
+
+	// Destructor
+	//		Unlinks every object (the objects themselves are untouched)
+	~IntrusiveDList() {
+		Clear();
+	}
+
+	// An object can only be linked into one list per hook, so lists can not be copied
+	IntrusiveDList(const IntrusiveDList&) = delete;
+	IntrusiveDList& operator=(const IntrusiveDList&) = delete;
+
+	// Move constructor
+	//		Takes over the objects of another list
+	// In:	_move			The list to move from (left empty)
+	IntrusiveDList(IntrusiveDList&& _move) noexcept {
+		Swap(_move);
+	}
+
+	// Move assignment operator
+	//		Takes over the objects of another list
+	// In:	_assign			The list to move from (left empty)
+	//
+	// Return: The invoking object (by reference)
+	IntrusiveDList& operator=(IntrusiveDList&& _assign) noexcept {
+		if (this != &_assign)
+		{
+			Clear();
+			Swap(_assign);
+		}
+		return *this;
+	}
+
+	// Exchange the contents of two lists
+	// In:	_other			The list to swap with
+	void Swap(IntrusiveDList& _other) noexcept {
+		std::swap(mHead, _other.mHead);
+		std::swap(mTail, _other.mTail);
+		std::swap(mSize, _other.mSize);
+	}
+
+	// Exchange the contents of two lists (found by std::swap-style calls)
+	friend void swap(IntrusiveDList& _a, IntrusiveDList& _b) noexcept {
+		_a.Swap(_b);
+	}
+
+	// Return: The number of objects in the list
+	size_t Size() const {
+		return mSize;
+	}
+
+	// Link an object at the front of the list
+	//
+	// In:	_object			The object to add to the list
+	void AddHead(Type& _object) {
+		LinkBefore(mHead, &_object);
+	}
+
+	// Link an object at the end of the list
+	//
+	// In:	_object			The object to add to the list
+	void AddTail(Type& _object) {
+		LinkBefore(nullptr, &_object);
+	}
+
+	// Unlink the object at the front of the list
+	//
+	// Return: The object that was removed (null if the list was empty)
+	Type* RemoveHead() {
+		Type* object = mHead;
+		if (object != nullptr)
+			Unlink(object);
+		return object;
+	}
+
+	// Unlink the object at the end of the list
+	//
+	// Return: The object that was removed (null if the list was empty)
+	Type* RemoveTail() {
+		Type* object = mTail;
+		if (object != nullptr)
+			Unlink(object);
+		return object;
+	}
+
+	// Unlink every object
+	//		Resets the list to its default state
+	void Clear() {
+		Type* curr = mHead;
+		while (curr != nullptr)
+		{
+			Type* next = HookOf(curr).next;
+			HookOf(curr) = IntrusiveListHook<Type>();
+			curr = next;
+		}
+
+		mHead = nullptr;
+		mTail = nullptr;
+		mSize = 0;
+	}
+
+	// Link an object *before* the passed-in iterator
+	//		Inserting at End adds to the tail
+	//
+	// In:	_iter		The iterator
+	//		_object		The object to add
+	//
+	// Return:	The iterator
+	// NOTE:	The iterator should now be pointing to the new object
+	Iterator Insert(Iterator& _iter, Type& _object) {
+		LinkBefore(_iter.mCurr, &_object);
+		_iter.mCurr = &_object;
+		return _iter;
+	}
+
+	// Unlink an object from the list (the object itself is untouched)
+	//
+	// In:	_iter		The iterator
+	//
+	// Return:	The iterator
+	// NOTE:	The iterator should now be pointing at the object after the one removed
+	Iterator Erase(Iterator& _iter) {
+		if (mSize == 0 || _iter.mCurr == nullptr)
+			return _iter;
+
+		Type* next = HookOf(_iter.mCurr).next;
+		Unlink(_iter.mCurr);
+		_iter.mCurr = next;
+		return _iter;
+	}
+
+	// Set an Iterator at the front of the list
+	//
+	// Return: An iterator pointing to the list's head
+	Iterator Begin() const {
+		Iterator val{};
+		val.mCurr = mHead;
+		return val;
+	}
+
+	// Set an Iterator pointing to the end of the list
+	//
+	// Return: An iterator that has its curr pointing to a null pointer
+	Iterator End() const {
+		Iterator val{};
+		val.mCurr = nullptr;
+		return val;
+	}
+
+private:
+
+	// Link an object in front of another
+	//
+	// In:	_pos		The object to link in front of (null links at the tail)
+	//		_object		The object to link
+	void LinkBefore(Type* _pos, Type* _object) {
+		Type* before = _pos != nullptr ? HookOf(_pos).prev : mTail;
+
+		HookOf(_object).prev = before;
+		HookOf(_object).next = _pos;
+
+		if (before != nullptr)
+			HookOf(before).next = _object;
+		else
+			mHead = _object;
+
+		if (_pos != nullptr)
+			HookOf(_pos).prev = _object;
+		else
+			mTail = _object;
+
+		++mSize;
+	}
+
+	// Take an object out of the list and reset its hook
+	void Unlink(Type* _object) {
+		IntrusiveListHook<Type>& hook = HookOf(_object);
+
+		if (hook.prev != nullptr)
+			HookOf(hook.prev).next = hook.next;
+		else
+			mHead = hook.next;
+
+		if (hook.next != nullptr)
+			HookOf(hook.next).prev = hook.prev;
+		else
+			mTail = hook.prev;
+
+		hook = IntrusiveListHook<Type>();
+		--mSize;
+	}
+};
@@ -47,6 +47,16 @@ NOTE: If the unit test is not on, that code will not be compiled!
 #define LAB2_CONTAINS_TRUE			1
 #define LAB2_CONTAINS_FALSE			1
 #define LAB2_MOVE_PALINDROMES		1
+#define LAB2_FILL_VALIDATION		1
+#define LAB2_FILE_VIEW				1
+#define LAB2_MOVE_PALINDROMES_PARALLEL	1
+#define LAB2_PALINDROME_KERNELS			1
+#define LAB2_SEARCH_MODES				1
+#define LAB2_SORT_BACKENDS				1
+#define LAB2_TEXT_PARSER				1
+#define LAB2_FILL_BENCHMARK			0
+#define LAB2_MOVE_PALINDROMES_BENCHMARK	0
+#define LAB2_SORT_BENCHMARK				0
 
 /************/
 /* Includes */
@@ -55,7 +65,13 @@ NOTE: If the unit test is not on, that code will not be compiled!
 #include <vector>
 #include <fstream>
 #include <algorithm>
+#include <functional>
+#include <execution>
 #include <iostream>
+#include "PalindromeClassifier.h"
+#include "IntSearch.h"
+#include "RadixSort.h"
+#include "IntTextParser.h"
 
 
 // Checks to see if a number is a palindrome (reads the same forwards and backwards)
@@ -81,32 +97,72 @@ class DSA_Lab2
 {
 	friend class UnitTests_Lab2;	// Giving access to test code
 
+public:
+
+	// How Contains looks for a value
+	enum class SearchMode {
+		Scan,		// Vectorized scan of mValues on every call (best for a few queries)
+		Indexed		// Search index built on the first call and reused until mValues changes
+	};
+
+	// Which algorithm Sort uses
+	enum class SortBackend {
+		Std,		// std::sort
+		Radix,		// LSD radix sort (linear time, needs a second buffer the size of mValues)
+		Parallel	// std::sort with std::execution::par_unseq
+	};
+
 private:
 
 	std::vector<int> mValues;		// contains all of the values
 	std::vector<int> mPalindromes;	// contains just the numbers that are palindromes (only used in MovePalindromes method)
 
+	SearchMode mSearchMode = SearchMode::Scan;
+	mutable EytzingerIndex mIndex;		// sorted copy of mValues for SearchMode::Indexed
+	mutable bool mIndexValid = false;	// false when mValues changed since mIndex was built
+
+	// Below this many values a scan beats building and searching the index
+	static const size_t mIndexMinSize = 64;
+
+	// Throw away the search index, mValues has changed
+	void InvalidateIndex() {
+		mIndex.Clear();
+		mIndexValid = false;
+	}
+
 public:
 
 	// Fill out the mValues vector with the contents of the binary file
 	//		First four bytes of the file are the number of ints in the file
+	//		The ints are read in a single call, straight into the vector
 	//
 	// In:	_input		Name of the file to open
+	//
+	// NOTE:	A missing file, missing header or negative count adds nothing
+	//			A truncated file only adds the ints that are fully present
 	void Fill(const char* _input) {
+		InvalidateIndex();
+
 		std::ifstream inputFile(_input, std::ios::in | std::ios::binary);
 		
-		int size;
+		int size = 0;
 
-		inputFile.read((char *)&size, sizeof(int));
+		if (!inputFile.read((char *)&size, sizeof(int)) || size <= 0)
+			return;
 
-		int num;
+		// Never trust the header for more ints than the file actually holds
+		inputFile.seekg(0, std::ios::end);
+		size_t available = (size_t)((std::streamoff)inputFile.tellg() - (std::streamoff)sizeof(int)) / sizeof(int);
+		inputFile.seekg(sizeof(int), std::ios::beg);
 
-		for (size_t i = 0; i < size; ++i)
-		{
-			inputFile.read((char *)&num, sizeof(int));
+		size_t count = (size_t)size < available ? (size_t)size : available;
+		size_t start = mValues.size();
 
-			mValues.push_back(num);
-		}
+		mValues.resize(start + count);
+		inputFile.read((char *)(mValues.data() + start), (std::streamsize)(count * sizeof(int)));
+
+		// Drop anything the read did not reach
+		mValues.resize(start + (size_t)inputFile.gcount() / sizeof(int));
 
 		inputFile.close();
 	}
@@ -116,6 +172,8 @@ public:
 	// In:	_arr			The array of values
 	//		_size			The number of elements in the array
 	void Fill(const int* _arr, size_t _size) {
+		InvalidateIndex();
+
 		if (!mValues.empty())
 			mValues.clear();
 
@@ -126,8 +184,25 @@ public:
 		return;
 	}
 
+	// Fill out the mValues vector with the contents of an integer text file
+	//		Ints are separated by whitespace (one per line, like numbers.txt)
+	//
+	// In:	_input		Name of the file to open
+	//		_threads	The number of threads to parse with (0 uses one per core)
+	//
+	// Return: True, if the file was opened and every token was an int
+	//
+	// NOTE:	Like the binary Fill, the ints are added after any existing values
+	bool FillText(const char* _input, unsigned int _threads = 1) {
+		InvalidateIndex();
+
+		return ParseIntText(_input, mValues, _threads);
+	}
+
 	// Remove all elements from vector and decrease capacity to 0
 	void Clear() {
+		InvalidateIndex();
+
 		mValues.clear();
 		mValues.shrink_to_fit();
 
@@ -138,10 +213,22 @@ public:
 	// Sort the vector 
 	//
 	// In:	_ascending		To sort in ascending order or not
+	//		_backend		The sorting algorithm to use
 	//
 	// NOTE: Use the std::sort method in this implementation
-	void Sort(bool _ascending) {
-		if (_ascending)
+	void Sort(bool _ascending, SortBackend _backend = SortBackend::Std) {
+		InvalidateIndex();
+
+		if (_backend == SortBackend::Radix)
+			RadixSortInts(mValues.data(), mValues.size(), _ascending);
+		else if (_backend == SortBackend::Parallel)
+		{
+			if (_ascending)
+				std::sort(std::execution::par_unseq, mValues.begin(), mValues.end(), std::less<int>());
+			else
+				std::sort(std::execution::par_unseq, mValues.begin(), mValues.end(), std::greater<int>());
+		}
+		else if (_ascending)
 			std::sort(mValues.begin(), mValues.end(),
 				[](const int i, const int j) -> bool
 				{
@@ -161,42 +248,88 @@ public:
 	}
 
 	// Determine if a value is present in the vector
+	//		How the value is looked for depends on the search mode (see SetSearchMode)
 	// 
 	// In:	_val		The value to find
 	//
 	// Return: True, if the value is present
 	bool Contains(int _val) const {
-		size_t size = mValues.size();
-		bool found;
-		for (size_t i = 0; i < size; ++i)
+		if (mSearchMode == SearchMode::Scan || mValues.size() < mIndexMinSize)
+			return ScanForInt(mValues.data(), mValues.size(), _val);
+
+		if (!mIndexValid)
 		{
-			found = mValues[i] == _val;
-			if (found)
-				break;
+			mIndex.Build(mValues.data(), mValues.size());
+			mIndexValid = true;
 		}
-		return found;
+		return mIndex.Contains(_val);
+	}
+
+	// Choose how Contains looks for values
+	//
+	// In:	_mode		The search mode to use from now on
+	void SetSearchMode(SearchMode _mode) {
+		mSearchMode = _mode;
+		if (_mode == SearchMode::Scan)
+			InvalidateIndex();
 	}
 
 	// Move all palindrome numbers from mValues vector to mPalindromes vector
+	//		Both vectors keep the relative order of their values
 	//
 	// Pseudocode:
+	//		check every value for being a palindrome in one batch
+	//		count the palindromes and make room for them once
 	//		iterate through the main values vector
 	//			if the value is a palindrome
 	//				add it to the palindrome vector
-	//				remove it from the values vector
-	void MovePalindromes() {	
+	//			otherwise
+	//				slide it down to the next open spot in the values vector
+	//		cut the values vector down to the values that were kept
+	void MovePalindromes() {
+		InvalidateIndex();
+
 		size_t values = mValues.size();
+		std::vector<uint8_t> isPalindrome(values);
+		ClassifyPalindromes(reinterpret_cast<const unsigned int*>(mValues.data()), values, isPalindrome.data());
+
+		size_t palindromes = 0;
 		for (size_t i = 0; i < values; ++i)
 		{
-			if (IsPalindromeNumber(mValues[i]))
-			{
+			palindromes += isPalindrome[i];
+		}
+
+		mPalindromes.reserve(mPalindromes.size() + palindromes);
+
+		size_t kept = 0;
+		for (size_t i = 0; i < values; ++i)
+		{
+			if (isPalindrome[i])
 				mPalindromes.push_back(mValues[i]);
-				mValues.erase(mValues.begin() + i);
-				--values;
-				--i;
-			}
+			else
+				mValues[kept++] = mValues[i];
 		}
+
+		mValues.resize(kept);
 		return;
 	}
-};
 
+	// Same as MovePalindromes, but the values are checked on multiple threads
+	//		Worth it for very large vectors, slower than MovePalindromes for small ones
+	void MovePalindromesParallel() {
+		InvalidateIndex();
+
+		auto isPalindrome = [](int _val) -> bool
+		{
+			return IsPalindromeNumber(_val);
+		};
+
+		size_t start = mPalindromes.size();
+		size_t palindromes = (size_t)std::count_if(std::execution::par, mValues.begin(), mValues.end(), isPalindrome);
+
+		mPalindromes.resize(start + palindromes);
+		std::copy_if(std::execution::par, mValues.begin(), mValues.end(), mPalindromes.begin() + start, isPalindrome);
+
+		mValues.erase(std::remove_if(std::execution::par, mValues.begin(), mValues.end(), isPalindrome), mValues.end());
+	}
+};
\ No newline at end of file
@@ -44,6 +44,11 @@ NOTE: If the unit test is not on, that code will not be compiled!
 #define LAB4_INSERT_ITER			1
 #define LAB4_INSERT_INDEX			1
 #define LAB4_REMOVE_DECIMAL			1
+#define LAB4_MPMC					1
+#define LAB4_MPMC_BENCHMARK			0
+#define LAB4_INDEXED_SEQUENCE		1
+#define LAB4_RING_DEQUE				1
+#define LAB4_DECIMAL_FILTER			1
 
 /************/
 /* Includes */
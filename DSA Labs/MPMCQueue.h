@@ -0,0 +1,504 @@
+/*
+File:			MPMCQueue.h
+Author(s):
+	Student: Terry Ellison <ellisonterry4@gmail.com>
+
+Created:		10.18.2026
+Last Modified:	10.18.2026
+Purpose:		Lock-free multi-producer / multi-consumer queues with the same
+				queue ordering add/remove calls as DSA_Lab4
+*/
+
+// Header protection
+#pragma once
+
+/************/
+/* Includes */
+/************/
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <thread>
+#include <utility>
+
+// Size used to keep the producer and consumer counters on separate cache lines
+#define MPMC_CACHE_LINE	64
+
+// A fixed-capacity lock-free queue for any number of producers and consumers
+//		(Dmitry Vyukov's bounded MPMC ring)
+//		Every cell carries a sequence number that says whose turn it is:
+//		a producer may fill cell i when its sequence is i, a consumer may empty it
+//		when its sequence is i + 1, and emptying sets it to i + capacity for the
+//		next lap around the ring
+//		Nothing is allocated after construction
+template<typename Type>
+class BoundedMPMCQueue {
+
+	struct Cell {
+		std::atomic<size_t> sequence;
+		alignas(Type) unsigned char storage[sizeof(Type)];
+
+		Type* Value() {
+			return reinterpret_cast<Type*>(storage);
+		}
+	};
+
+	// Data members
+	Cell* mBuffer;
+	size_t mMask;		// Capacity - 1 (the capacity is a power of 2)
+
+	alignas(MPMC_CACHE_LINE) std::atomic<size_t> mEnqueuePos;
+	alignas(MPMC_CACHE_LINE) std::atomic<size_t> mDequeuePos;
+
+public:
+
+	// Constructor
+	//
+	// In:	_capacity		The most values the queue can hold (rounded up to a power of 2)
+	explicit BoundedMPMCQueue(size_t _capacity) {
+		size_t capacity = 2;
+		while (capacity < _capacity)
+			capacity *= 2;
+
+		mBuffer = new Cell[capacity];
+		mMask = capacity - 1;
+		for (size_t i = 0; i < capacity; ++i)
+		{
+			mBuffer[i].sequence.store(i, std::memory_order_relaxed);
+		}
+
+		mEnqueuePos.store(0, std::memory_order_relaxed);
+		mDequeuePos.store(0, std::memory_order_relaxed);
+	}
+
+	// Destructor
+	//		Destroys any values still in the queue (no other thread may be using it)
+	~BoundedMPMCQueue() {
+		size_t end = mEnqueuePos.load(std::memory_order_relaxed);
+		for (size_t pos = mDequeuePos.load(std::memory_order_relaxed); pos != end; ++pos)
+		{
+			mBuffer[pos & mMask].Value()->~Type();
+		}
+		delete[] mBuffer;
+	}
+
+	BoundedMPMCQueue(const BoundedMPMCQueue&) = delete;
+	BoundedMPMCQueue& operator=(const BoundedMPMCQueue&) = delete;
+
+	// Return: The most values the queue can hold
+	size_t Capacity() const {
+		return mMask + 1;
+	}
+
+	// Add a value to the back of the queue
+	//
+	// In:	_val		The value to add
+	//
+	// Return: True, if there was room for it
+	template<typename Value>
+	bool TryPush(Value&& _val) {
+		size_t pos = mEnqueuePos.load(std::memory_order_relaxed);
+
+		while (true)
+		{
+			Cell& cell = mBuffer[pos & mMask];
+			size_t sequence = cell.sequence.load(std::memory_order_acquire);
+			intptr_t turn = (intptr_t)sequence - (intptr_t)pos;
+
+			if (turn == 0)
+			{
+				if (mEnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+				{
+					::new (cell.Value()) Type(std::forward<Value>(_val));
+					cell.sequence.store(pos + 1, std::memory_order_release);
+					return true;
+				}
+			}
+			else if (turn < 0)
+				return false;		// The cell still holds a value from the last lap, so the queue is full
+			else
+				pos = mEnqueuePos.load(std::memory_order_relaxed);
+		}
+	}
+
+	// Remove the value at the front of the queue
+	//
+	// In:	_out		Receives the value
+	//
+	// Return: True, if there was a value to remove
+	bool TryPop(Type& _out) {
+		size_t pos = mDequeuePos.load(std::memory_order_relaxed);
+
+		while (true)
+		{
+			Cell& cell = mBuffer[pos & mMask];
+			size_t sequence = cell.sequence.load(std::memory_order_acquire);
+			intptr_t turn = (intptr_t)sequence - (intptr_t)(pos + 1);
+
+			if (turn == 0)
+			{
+				if (mDequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+				{
+					_out = std::move(*cell.Value());
+					cell.Value()->~Type();
+					cell.sequence.store(pos + mMask + 1, std::memory_order_release);
+					return true;
+				}
+			}
+			else if (turn < 0)
+				return false;		// The cell has not been filled yet, so the queue is empty
+			else
+				pos = mDequeuePos.load(std::memory_order_relaxed);
+		}
+	}
+
+	// Add all of the values from the array using queue ordering
+	//		Stops early if the queue fills up
+	//
+	// In:	_arr			The array of values
+	//		_size			The number of elements in the array
+	//
+	// Return: The number of values added (the first ones in the array)
+	size_t QueueOrderingAdd(const Type* _arr, size_t _size) {
+		for (size_t i = 0; i < _size; ++i)
+		{
+			if (!TryPush(_arr[i]))
+				return i;
+		}
+		return _size;
+	}
+
+	// Remove a single value using queue ordering
+	//
+	// In:	_out		Receives the value
+	//
+	// Return: True, if there was a value to remove
+	bool QueueOrderingRemove(Type& _out) {
+		return TryPop(_out);
+	}
+
+	// Remove up to _max values using queue ordering
+	//
+	// In:	_out		Receives the values
+	//		_max		The most values to remove
+	//
+	// Return: The number of values removed
+	size_t QueueOrderingRemove(Type* _out, size_t _max) {
+		size_t removed = 0;
+		while (removed < _max && TryPop(_out[removed]))
+			++removed;
+		return removed;
+	}
+};
+
+// An unbounded lock-free queue for any number of producers and consumers
+//		Values go into a chain of fixed-size segments. Producers and consumers
+//		claim slots with a single fetch_add on the segment's counters, and a
+//		new segment is linked on when the last one runs out of slots
+//		A consumer that reaches a slot before its producer has written it marks
+//		the slot as skipped, and the producer claims another one
+//		Drained segments are freed with epochs: a segment retired during epoch e
+//		is freed once the epoch reaches e + 2, which can only happen after every
+//		thread that was inside the queue during epoch e has left it
+//		(so at most three epochs' worth of segments ever wait to be freed)
+template<typename Type, size_t SegmentSize = 1024>
+class SegmentedMPMCQueue {
+
+	static_assert(SegmentSize >= 2, "SegmentedMPMCQueue needs at least two slots per segment");
+
+	// Slot states
+	enum : int { SlotEmpty, SlotWriting, SlotFull, SlotTaken, SlotSkipped };
+
+	struct Slot {
+		std::atomic<int> state{ SlotEmpty };
+		alignas(Type) unsigned char storage[sizeof(Type)];
+
+		Type* Value() {
+			return reinterpret_cast<Type*>(storage);
+		}
+	};
+
+	struct Segment {
+		alignas(MPMC_CACHE_LINE) std::atomic<size_t> enqueueIndex{ 0 };
+		alignas(MPMC_CACHE_LINE) std::atomic<size_t> dequeueIndex{ 0 };
+		std::atomic<Segment*> next{ nullptr };
+		Segment* retiredNext = nullptr;
+		void* allocation = nullptr;		// The block from operator new this segment was placed in
+		Slot slots[SegmentSize];
+	};
+
+	// Data members
+	alignas(MPMC_CACHE_LINE) std::atomic<Segment*> mHead;
+	alignas(MPMC_CACHE_LINE) std::atomic<Segment*> mTail;
+	alignas(MPMC_CACHE_LINE) std::atomic<size_t> mEpoch{ 0 };
+	std::atomic<size_t> mActive[2] = {};					// Threads inside Push or TryPop, by the parity of the epoch they entered in
+	std::atomic<Segment*> mRetired[3] = {};					// Unlinked segments waiting to be freed, by the epoch they were retired in
+
+	// Counts a thread in on construction and out on destruction,
+	// trying to move the epoch on (and free old segments) on the way out
+	class ActiveGuard {
+		SegmentedMPMCQueue& mQueue;
+		size_t mEpoch;
+	public:
+		ActiveGuard(SegmentedMPMCQueue& _queue) : mQueue(_queue) {
+			mEpoch = mQueue.Enter();
+		}
+		~ActiveGuard() {
+			mQueue.TryAdvanceEpoch();
+			mQueue.mActive[mEpoch & 1].fetch_sub(1);
+		}
+	};
+
+public:
+
+	// Constructor
+	//		Starts with one empty segment
+	SegmentedMPMCQueue() {
+		Segment* first = NewSegment();
+		mHead.store(first, std::memory_order_relaxed);
+		mTail.store(first, std::memory_order_relaxed);
+	}
+
+	// Destructor
+	//		Destroys any values still in the queue and frees every segment
+	//		(no other thread may be using it)
+	~SegmentedMPMCQueue() {
+		Segment* segment = mHead.load(std::memory_order_relaxed);
+		while (segment != nullptr)
+		{
+			for (Slot& slot : segment->slots)
+			{
+				if (slot.state.load(std::memory_order_relaxed) == SlotFull)
+					slot.Value()->~Type();
+			}
+
+			Segment* next = segment->next.load(std::memory_order_relaxed);
+			DeleteSegment(segment);
+			segment = next;
+		}
+
+		for (std::atomic<Segment*>& retired : mRetired)
+		{
+			DeleteChain(retired.load(std::memory_order_relaxed));
+		}
+	}
+
+	SegmentedMPMCQueue(const SegmentedMPMCQueue&) = delete;
+	SegmentedMPMCQueue& operator=(const SegmentedMPMCQueue&) = delete;
+
+	// Add a value to the back of the queue (always succeeds)
+	//
+	// In:	_val		The value to add
+	template<typename Value>
+	void Push(Value&& _val) {
+		ActiveGuard guard(*this);
+
+		while (true)
+		{
+			Segment* tail = mTail.load();
+			size_t index = tail->enqueueIndex.fetch_add(1);
+
+			if (index < SegmentSize)
+			{
+				Slot& slot = tail->slots[index];
+				int expected = SlotEmpty;
+				if (slot.state.compare_exchange_strong(expected, SlotWriting))
+				{
+					::new (slot.Value()) Type(std::forward<Value>(_val));
+					slot.state.store(SlotFull, std::memory_order_release);
+					return;
+				}
+				continue;	// A consumer skipped this slot, claim another
+			}
+
+			// This segment is used up, move on to (or create) the next one
+			if (tail != mTail.load())
+				continue;
+
+			Segment* next = tail->next.load();
+			if (next != nullptr)
+			{
+				mTail.compare_exchange_strong(tail, next);
+				continue;
+			}
+
+			// Link a new segment with its first slot already claimed by this producer
+			// (marked as being written, so a consumer that gets there first waits)
+			Segment* segment = NewSegment();
+			segment->enqueueIndex.store(1, std::memory_order_relaxed);
+			segment->slots[0].state.store(SlotWriting, std::memory_order_relaxed);
+
+			Segment* expected = nullptr;
+			if (tail->next.compare_exchange_strong(expected, segment))
+			{
+				mTail.compare_exchange_strong(tail, segment);
+				::new (segment->slots[0].Value()) Type(std::forward<Value>(_val));
+				segment->slots[0].state.store(SlotFull, std::memory_order_release);
+				return;
+			}
+
+			// Another producer linked a segment first
+			DeleteSegment(segment);
+		}
+	}
+
+	// Remove the value at the front of the queue
+	//
+	// In:	_out		Receives the value
+	//
+	// Return: True, if there was a value to remove
+	bool TryPop(Type& _out) {
+		ActiveGuard guard(*this);
+
+		while (true)
+		{
+			Segment* head = mHead.load();
+
+			if (head->dequeueIndex.load() >= head->enqueueIndex.load() && head->next.load() == nullptr)
+				return false;
+
+			size_t index = head->dequeueIndex.fetch_add(1);
+			if (index < SegmentSize)
+			{
+				Slot& slot = head->slots[index];
+				int expected = SlotEmpty;
+				if (slot.state.compare_exchange_strong(expected, SlotSkipped))
+					continue;	// The producer has not claimed it yet, it will claim another slot
+
+				// The producer is part way through writing, wait for it
+				while (slot.state.load(std::memory_order_acquire) != SlotFull)
+					std::this_thread::yield();
+
+				_out = std::move(*slot.Value());
+				slot.Value()->~Type();
+				slot.state.store(SlotTaken, std::memory_order_relaxed);
+				return true;
+			}
+
+			// This segment is drained, move on to the next one
+			Segment* next = head->next.load();
+			if (next == nullptr)
+				return false;
+
+			// The tail must never be left on a segment that is about to be freed
+			Segment* tail = head;
+			mTail.compare_exchange_strong(tail, next);
+
+			if (mHead.compare_exchange_strong(head, next))
+				Retire(head);
+		}
+	}
+
+	// Add all of the values from the array using queue ordering
+	//
+	// In:	_arr			The array of values
+	//		_size			The number of elements in the array
+	void QueueOrderingAdd(const Type* _arr, size_t _size) {
+		for (size_t i = 0; i < _size; ++i)
+		{
+			Push(_arr[i]);
+		}
+	}
+
+	// Remove a single value using queue ordering
+	//
+	// In:	_out		Receives the value
+	//
+	// Return: True, if there was a value to remove
+	bool QueueOrderingRemove(Type& _out) {
+		return TryPop(_out);
+	}
+
+	// Remove up to _max values using queue ordering
+	//
+	// In:	_out		Receives the values
+	//		_max		The most values to remove
+	//
+	// Return: The number of values removed
+	size_t QueueOrderingRemove(Type* _out, size_t _max) {
+		size_t removed = 0;
+		while (removed < _max && TryPop(_out[removed]))
+			++removed;
+		return removed;
+	}
+
+private:
+
+	// Make a new empty segment
+	//		Segments are over-aligned, so the block is over-allocated from the plain
+	//		operator new and the segment is placed at the first cache line inside it
+	//		(an aligned operator new would bypass any replacement of the plain one)
+	static Segment* NewSegment() {
+		void* allocation = ::operator new(sizeof(Segment) + MPMC_CACHE_LINE);
+		uintptr_t aligned = ((uintptr_t)allocation + MPMC_CACHE_LINE - 1) & ~(uintptr_t)(MPMC_CACHE_LINE - 1);
+
+		Segment* segment = ::new ((void*)aligned) Segment();
+		segment->allocation = allocation;
+		return segment;
+	}
+
+	// Free a segment made by NewSegment (any values in it must already be destroyed)
+	static void DeleteSegment(Segment* _segment) {
+		void* allocation = _segment->allocation;
+		_segment->~Segment();
+		::operator delete(allocation);
+	}
+
+	// Count this thread in under the current epoch
+	//
+	// Return: The epoch it was counted in under
+	size_t Enter() {
+		while (true)
+		{
+			size_t epoch = mEpoch.load();
+			mActive[epoch & 1].fetch_add(1);
+
+			// If the epoch moved on meanwhile, the count may have been missed by the thread moving it
+			if (mEpoch.load() == epoch)
+				return epoch;
+			mActive[epoch & 1].fetch_sub(1);
+		}
+	}
+
+	// Put an unlinked segment on the retired list of the current epoch
+	void Retire(Segment* _segment) {
+		std::atomic<Segment*>& retired = mRetired[mEpoch.load() % 3];
+		Segment* top = retired.load();
+		do
+		{
+			_segment->retiredNext = top;
+		} while (!retired.compare_exchange_weak(top, _segment));
+	}
+
+	// Move from epoch e to e + 1 if no thread that entered in epoch e - 1 is still inside,
+	// then free the segments retired in epoch e - 1
+	//		A thread inside the queue holds the epoch back to at most one past the one
+	//		it entered in, so nothing it could be looking at is freed
+	//		(called by a thread that is still counted in, which is what stops the epoch
+	//		moving on again before the old list has been taken)
+	void TryAdvanceEpoch() {
+		if (mRetired[0].load(std::memory_order_relaxed) == nullptr &&
+			mRetired[1].load(std::memory_order_relaxed) == nullptr &&
+			mRetired[2].load(std::memory_order_relaxed) == nullptr)
+			return;
+
+		size_t epoch = mEpoch.load();
+		if (mActive[(epoch + 1) & 1].load() != 0)
+			return;
+		if (!mEpoch.compare_exchange_strong(epoch, epoch + 1))
+			return;
+
+		DeleteChain(mRetired[(epoch + 2) % 3].exchange(nullptr));
+	}
+
+	// Delete a chain of retired segments
+	static void DeleteChain(Segment* _chain) {
+		while (_chain != nullptr)
+		{
+			Segment* next = _chain->retiredNext;
+			DeleteSegment(_chain);
+			_chain = next;
+		}
+	}
+};
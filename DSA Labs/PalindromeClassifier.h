@@ -0,0 +1,161 @@
+/*
+File:			PalindromeClassifier.h
+Author(s):
+	Student: Terry Ellison <ellisonterry4@gmail.com>
+
+Created:		10.18.2026
+Last Modified:	10.18.2026
+Purpose:		Checks whole arrays of numbers for palindromes at once,
+				using SSE4.1 or AVX2 when the CPU has them
+*/
+
+// Header protection
+#pragma once
+
+/************/
+/* Includes */
+/************/
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include "CpuFeatures.h"
+
+// Signature shared by every classifier kernel
+//
+// In:	_in			The numbers to check
+//		_count		The number of numbers
+//		_out		Receives 1 for every palindrome and 0 for everything else
+using PalindromeKernel = void(*)(const unsigned int* _in, size_t _count, uint8_t* _out);
+
+// Reference kernel, one number at a time (same reversal as IsPalindromeNumber)
+inline void ClassifyPalindromesScalar(const unsigned int* _in, size_t _count, uint8_t* _out) {
+	for (size_t i = 0; i < _count; ++i)
+	{
+		unsigned int reverse = 0, numCpy = _in[i];
+
+		while (numCpy != 0)
+		{
+			unsigned int quotient = numCpy / 10;
+			reverse = (reverse * 10) + (numCpy - quotient * 10);
+			numCpy = quotient;
+		}
+
+		_out[i] = reverse == _in[i];
+	}
+}
+
+#if SIMD_X86
+
+// Checks four numbers per step
+//		Division by 10 is done as a multiply by 0xCCCCCCCD and a shift right by 35,
+//		which gives the exact quotient for every 32 bit value
+//		A lane stops updating its reversed number once its own digits run out,
+//		so the result matches the scalar version bit for bit (overflow included)
+SIMD_TARGET("sse4.1")
+inline void ClassifyPalindromesSSE41(const unsigned int* _in, size_t _count, uint8_t* _out) {
+	const __m128i magic = _mm_set1_epi32((int)0xCCCCCCCDu);
+	const __m128i ten = _mm_set1_epi32(10);
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i one = _mm_set1_epi8(1);
+
+	size_t i = 0;
+	for (; i + 4 <= _count; i += 4)
+	{
+		const __m128i num = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_in + i));
+		__m128i numCpy = num;
+		__m128i reverse = zero;
+
+		while (!_mm_testz_si128(numCpy, numCpy))
+		{
+			// Lanes 0 and 2 come out of the low halves, lanes 1 and 3 have to be shifted down first
+			__m128i evenQuotient = _mm_srli_epi64(_mm_mul_epu32(numCpy, magic), 35);
+			__m128i oddQuotient = _mm_srli_epi64(_mm_mul_epu32(_mm_srli_epi64(numCpy, 32), magic), 35);
+			__m128i quotient = _mm_blend_epi16(evenQuotient, _mm_slli_epi64(oddQuotient, 32), 0xCC);
+
+			__m128i digit = _mm_sub_epi32(numCpy, _mm_mullo_epi32(quotient, ten));
+			__m128i stepped = _mm_add_epi32(_mm_mullo_epi32(reverse, ten), digit);
+			__m128i active = _mm_xor_si128(_mm_cmpeq_epi32(numCpy, zero), _mm_set1_epi32(-1));
+
+			reverse = _mm_blendv_epi8(reverse, stepped, active);
+			numCpy = quotient;
+		}
+
+		// Narrow the 32 bit lane masks down to one byte each
+		__m128i matches = _mm_cmpeq_epi32(reverse, num);
+		matches = _mm_packs_epi32(matches, matches);
+		matches = _mm_packs_epi16(matches, matches);
+		matches = _mm_and_si128(matches, one);
+
+		int packed = _mm_cvtsi128_si32(matches);
+		std::memcpy(_out + i, &packed, 4);
+	}
+
+	ClassifyPalindromesScalar(_in + i, _count - i, _out + i);
+}
+
+// Checks eight numbers per step (same approach as the SSE4.1 kernel)
+SIMD_TARGET("avx2")
+inline void ClassifyPalindromesAVX2(const unsigned int* _in, size_t _count, uint8_t* _out) {
+	const __m256i magic = _mm256_set1_epi32((int)0xCCCCCCCDu);
+	const __m256i ten = _mm256_set1_epi32(10);
+	const __m256i zero = _mm256_setzero_si256();
+
+	size_t i = 0;
+	for (; i + 8 <= _count; i += 8)
+	{
+		const __m256i num = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_in + i));
+		__m256i numCpy = num;
+		__m256i reverse = zero;
+
+		while (!_mm256_testz_si256(numCpy, numCpy))
+		{
+			__m256i evenQuotient = _mm256_srli_epi64(_mm256_mul_epu32(numCpy, magic), 35);
+			__m256i oddQuotient = _mm256_srli_epi64(_mm256_mul_epu32(_mm256_srli_epi64(numCpy, 32), magic), 35);
+			__m256i quotient = _mm256_blend_epi32(evenQuotient, _mm256_slli_epi64(oddQuotient, 32), 0xAA);
+
+			__m256i digit = _mm256_sub_epi32(numCpy, _mm256_mullo_epi32(quotient, ten));
+			__m256i stepped = _mm256_add_epi32(_mm256_mullo_epi32(reverse, ten), digit);
+			__m256i active = _mm256_xor_si256(_mm256_cmpeq_epi32(numCpy, zero), _mm256_set1_epi32(-1));
+
+			reverse = _mm256_blendv_epi8(reverse, stepped, active);
+			numCpy = quotient;
+		}
+
+		int mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(reverse, num)));
+		for (int lane = 0; lane < 8; ++lane)
+		{
+			_out[i + lane] = (uint8_t)((mask >> lane) & 1);
+		}
+	}
+
+	ClassifyPalindromesScalar(_in + i, _count - i, _out + i);
+}
+
+#endif
+
+// Pick the fastest kernel the CPU running the program supports
+//
+// Return: The kernel to use
+inline PalindromeKernel SelectPalindromeKernel() {
+#if SIMD_X86
+	const CpuFeatures& cpu = GetCpuFeatures();
+
+	if (cpu.avx2)
+		return ClassifyPalindromesAVX2;
+	if (cpu.sse41)
+		return ClassifyPalindromesSSE41;
+#endif
+
+	return ClassifyPalindromesScalar;
+}
+
+// Check an array of numbers for palindromes
+//		The kernel is picked the first time this is called
+//
+// In:	_in			The numbers to check
+//		_count		The number of numbers
+//		_out		Receives 1 for every palindrome and 0 for everything else
+inline void ClassifyPalindromes(const unsigned int* _in, size_t _count, uint8_t* _out) {
+	static const PalindromeKernel kernel = SelectPalindromeKernel();
+	kernel(_in, _count, _out);
+}
@@ -0,0 +1,88 @@
+/*
+File:			RadixSort.h
+Author(s):
+	Student: Terry Ellison <ellisonterry4@gmail.com>
+
+Created:		10.18.2026
+Last Modified:	10.18.2026
+Purpose:		LSD radix sort for 32 bit ints
+*/
+
+// Header protection
+#pragma once
+
+/************/
+/* Includes */
+/************/
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Sort ints with a least significant digit radix sort (4 passes of 8 bits)
+//		Runs in linear time, but needs a scratch buffer as big as the input
+//
+// In:	_values			The ints to sort
+//		_count			The number of ints
+//		_ascending		To sort in ascending order or not
+//
+// NOTE:	Each int is mapped to an unsigned key whose order matches the order asked for
+//			(flip the sign bit for ascending, flip every other bit as well for descending)
+inline void RadixSortInts(int* _values, size_t _count, bool _ascending) {
+	if (_count < 2)
+		return;
+
+	const uint32_t flip = _ascending ? 0x80000000u : 0x7FFFFFFFu;
+
+	// Count every digit of every key in a single pass
+	size_t counts[4][256] = {};
+	for (size_t i = 0; i < _count; ++i)
+	{
+		uint32_t key = (uint32_t)_values[i] ^ flip;
+		++counts[0][key & 0xFF];
+		++counts[1][(key >> 8) & 0xFF];
+		++counts[2][(key >> 16) & 0xFF];
+		++counts[3][key >> 24];
+	}
+
+	std::vector<int> scratch(_count);
+	int* from = _values;
+	int* to = scratch.data();
+
+	for (int pass = 0; pass < 4; ++pass)
+	{
+		int shift = pass * 8;
+		size_t* count = counts[pass];
+
+		// Every key has the same digit here, so this pass would not move anything
+		if (count[((uint32_t)from[0] ^ flip) >> shift & 0xFF] == _count)
+			continue;
+
+		// Turn the counts into the starting offset of each digit
+		size_t offset = 0;
+		for (int digit = 0; digit < 256; ++digit)
+		{
+			size_t digitCount = count[digit];
+			count[digit] = offset;
+			offset += digitCount;
+		}
+
+		for (size_t i = 0; i < _count; ++i)
+		{
+			uint32_t key = (uint32_t)from[i] ^ flip;
+			to[count[(key >> shift) & 0xFF]++] = from[i];
+		}
+
+		int* swap = from;
+		from = to;
+		to = swap;
+	}
+
+	// An odd number of passes leaves the result in the scratch buffer
+	if (from != _values)
+	{
+		for (size_t i = 0; i < _count; ++i)
+		{
+			_values[i] = from[i];
+		}
+	}
+}
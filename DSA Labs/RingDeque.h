@@ -0,0 +1,297 @@
+/*
+File:			RingDeque.h
+Author(s):
+	Student: Terry Ellison <ellisonterry4@gmail.com>
+
+Created:		10.18.2026
+Last Modified:	10.18.2026
+Purpose:		A contiguous ring buffer deque with the stack and queue
+				ordering calls of DSA_Lab4
+*/
+
+// Header protection
+#pragma once
+
+/************/
+/* Includes */
+/************/
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+// A double-ended queue stored in one power of 2 sized ring buffer
+//		Values are copied in and out with memcpy, so Type has to be trivially copyable
+//		A batch touches at most two runs of the buffer (before and after the wrap),
+//		so every batch add or remove is at most two block copies
+//		Ordering matches DSA_Lab4: the front is the head of the queue and the top
+//		of the stack, so both removes take from the front
+template<typename Type>
+class RingDeque {
+
+	static_assert(std::is_trivially_copyable<Type>::value, "RingDeque copies values with memcpy");
+
+	// Data members
+	Type* mArray = nullptr;
+	size_t mMask = 0;		// Capacity - 1 (the capacity is 0 or a power of 2)
+	size_t mHead = 0;		// Index of the front value
+	size_t mSize = 0;
+
+public:
+
+	// Default constructor
+	//		Creates a new empty deque (nothing is allocated until the first add)
+	RingDeque() = default;
+
+	// Destructor
+	//		Cleans up all dynamically allocated memory
+	~RingDeque() {
+		delete[] mArray;
+	}
+
+	// Copy constructor
+	//		Used to initialize one object to another
+	// In:	_copy			The object to copy from
+	RingDeque(const RingDeque& _copy) {
+		*this = _copy;
+	}
+
+	// Assignment operator
+	//		Used to assign one object to another
+	// In:	_assign			The object to assign from
+	//
+	// Return: The invoking object (by reference)
+	//		This allows us to daisy-chain
+	RingDeque& operator=(const RingDeque& _assign) {
+		if (this != &_assign)
+		{
+			Clear();
+			Reserve(_assign.mSize);
+			_assign.CopyOut(0, mArray, _assign.mSize);
+			mSize = _assign.mSize;
+		}
+		return *this;
+	}
+
+	// Move constructor
+	//		Takes over the buffer of another object without copying it
+	// In:	_move			The object to move from (left empty, with no buffer)
+	RingDeque(RingDeque&& _move) noexcept {
+		Swap(_move);
+	}
+
+	// Move assignment operator
+	//		Takes over the buffer of another object without copying it
+	// In:	_assign			The object to move from (left empty, with no buffer)
+	//
+	// Return: The invoking object (by reference)
+	RingDeque& operator=(RingDeque&& _assign) noexcept {
+		if (this != &_assign)
+		{
+			delete[] mArray;
+			mArray = nullptr;
+			mMask = 0;
+			mHead = 0;
+			mSize = 0;
+			Swap(_assign);
+		}
+		return *this;
+	}
+
+	// Exchange the contents of two deques
+	// In:	_other			The deque to swap with
+	void Swap(RingDeque& _other) noexcept {
+		std::swap(mArray, _other.mArray);
+		std::swap(mMask, _other.mMask);
+		std::swap(mHead, _other.mHead);
+		std::swap(mSize, _other.mSize);
+	}
+
+	// Exchange the contents of two deques (found by std::swap-style calls)
+	friend void swap(RingDeque& _a, RingDeque& _b) noexcept {
+		_a.Swap(_b);
+	}
+
+	// Return: The number of values in the deque
+	size_t Size() const {
+		return mSize;
+	}
+
+	// Return: The number of values the deque can hold before it grows
+	size_t Capacity() const {
+		return mArray != nullptr ? mMask + 1 : 0;
+	}
+
+	// Remove every value (the buffer is kept)
+	void Clear() {
+		mHead = 0;
+		mSize = 0;
+	}
+
+	// Make sure the deque can hold at least _count values without growing
+	//
+	// In:	_count			The number of values to make room for
+	void Reserve(size_t _count) {
+		if (_count <= Capacity())
+			return;
+
+		size_t capacity = 16;
+		while (capacity < _count)
+			capacity *= 2;
+
+		Type* array = new Type[capacity];
+		CopyOut(0, array, mSize);
+		delete[] mArray;
+
+		mArray = array;
+		mMask = capacity - 1;
+		mHead = 0;
+	}
+
+	// Access a value by its distance from the front
+	//
+	// In:	_index			The distance from the front
+	//
+	// Return: The value at that spot (by reference)
+	Type& operator[](size_t _index) {
+		return mArray[(mHead + _index) & mMask];
+	}
+	const Type& operator[](size_t _index) const {
+		return mArray[(mHead + _index) & mMask];
+	}
+
+	// Add a value at the front
+	void PushFront(const Type& _val) {
+		Reserve(mSize + 1);
+		mHead = (mHead - 1) & mMask;
+		mArray[mHead] = _val;
+		++mSize;
+	}
+
+	// Add a value at the back
+	void PushBack(const Type& _val) {
+		Reserve(mSize + 1);
+		mArray[(mHead + mSize) & mMask] = _val;
+		++mSize;
+	}
+
+	// Remove the value at the front
+	//
+	// Return: The value that was removed
+	Type PopFront() {
+		Type val = mArray[mHead];
+		mHead = (mHead + 1) & mMask;
+		--mSize;
+		return val;
+	}
+
+	// Remove the value at the back
+	//
+	// Return: The value that was removed
+	Type PopBack() {
+		--mSize;
+		return mArray[(mHead + mSize) & mMask];
+	}
+
+	// Add all of the values from the array using queue ordering
+	//		The values go on the back in order, one memcpy per run of the buffer
+	//
+	// In:	_arr			The array of values
+	//		_size			The number of elements in the array
+	void QueueOrderingAdd(const Type* _arr, size_t _size) {
+		if (_size == 0)
+			return;
+		Reserve(mSize + _size);
+
+		size_t start = (mHead + mSize) & mMask;
+		size_t firstRun = std::min(_size, mMask + 1 - start);
+		std::memcpy(mArray + start, _arr, firstRun * sizeof(Type));
+		std::memcpy(mArray, _arr + firstRun, (_size - firstRun) * sizeof(Type));
+
+		mSize += _size;
+	}
+
+	// Add all of the values from the array using stack ordering
+	//		The values go on the front, so the last one in the array ends up on top
+	//		(one reversed copy per run of the buffer)
+	//
+	// In:	_arr			The array of values
+	//		_size			The number of elements in the array
+	void StackOrderingAdd(const Type* _arr, size_t _size) {
+		if (_size == 0)
+			return;
+		Reserve(mSize + _size);
+
+		size_t start = (mHead - _size) & mMask;
+		size_t firstRun = std::min(_size, mMask + 1 - start);
+
+		// The front of the buffer gets the end of the array, reversed
+		std::reverse_copy(_arr + _size - firstRun, _arr + _size, mArray + start);
+		std::reverse_copy(_arr, _arr + _size - firstRun, mArray);
+
+		mHead = start;
+		mSize += _size;
+	}
+
+	// Remove a single value using queue ordering
+	//
+	// Return: The value that was removed
+	Type QueueOrderingRemove() {
+		return PopFront();
+	}
+
+	// Remove a single value using stack ordering
+	//
+	// Return: The value that was removed
+	Type StackOrderingRemove() {
+		return PopFront();
+	}
+
+	// Remove up to _max values using queue ordering
+	//
+	// In:	_out			Receives the values, in the order they were removed
+	//		_max			The most values to remove
+	//
+	// Return: The number of values removed
+	size_t QueueOrderingRemove(Type* _out, size_t _max) {
+		return RemoveFront(_out, _max);
+	}
+
+	// Remove up to _max values using stack ordering
+	//
+	// In:	_out			Receives the values, in the order they were removed
+	//		_max			The most values to remove
+	//
+	// Return: The number of values removed
+	size_t StackOrderingRemove(Type* _out, size_t _max) {
+		return RemoveFront(_out, _max);
+	}
+
+private:
+
+	// Copy values out of the ring, one memcpy per run of the buffer
+	//
+	// In:	_index			Distance from the front of the first value to copy
+	//		_out			Receives the values
+	//		_count			The number of values to copy
+	void CopyOut(size_t _index, Type* _out, size_t _count) const {
+		if (_count == 0)
+			return;
+
+		size_t start = (mHead + _index) & mMask;
+		size_t firstRun = std::min(_count, mMask + 1 - start);
+		std::memcpy(_out, mArray + start, firstRun * sizeof(Type));
+		std::memcpy(_out + firstRun, mArray, (_count - firstRun) * sizeof(Type));
+	}
+
+	// Remove up to _max values from the front into a buffer
+	size_t RemoveFront(Type* _out, size_t _max) {
+		size_t count = std::min(_max, mSize);
+		CopyOut(0, _out, count);
+
+		mHead = (mHead + count) & mMask;
+		mSize -= count;
+		return count;
+	}
+};
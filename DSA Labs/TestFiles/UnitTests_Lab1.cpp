@@ -14,7 +14,11 @@ Notes:			Property of Full Sail University
 /************/
 #include "UnitTests_Lab1.h"
 #include "Memory_Management.h"
+#include <chrono>
 #include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
 
 #pragma warning(disable:6386)
 
@@ -65,6 +69,33 @@ void UnitTests_Lab1::FullBattery() {
 #if LAB1_COPY_CONSTRUCTOR
 	Battery_CopyConstructor();
 #endif
+#if LAB1_MOVE_SEMANTICS
+	Battery_MoveSemantics();
+#endif
+#if LAB1_ALLOCATORS
+	Battery_Allocators();
+#endif
+#if LAB1_SMALL_ARRAY
+	Battery_SmallArray();
+#endif
+#if LAB1_GROWTH_POLICY
+	Battery_GrowthPolicy();
+#endif
+#if LAB1_BULK_OPERATIONS
+	Battery_BulkOperations();
+#endif
+#if LAB1_APPEND_BENCHMARK
+	Benchmark_MoveAwareAppend();
+#endif
+#if LAB1_TRIVIAL_COPY_BENCHMARK
+	Benchmark_TriviallyCopyableGrowth();
+#endif
+#if LAB1_SMALL_ARRAY_BENCHMARK
+	Benchmark_SmallArrays();
+#endif
+#if LAB1_GROWTH_BENCHMARK
+	Benchmark_GrowthPolicies();
+#endif
 }
 
 // Fills in a DynArray object with valid values
@@ -85,6 +116,20 @@ void UnitTests_Lab1::ArrayNegativeOneProtection(DynArray<int>& _da) {
 		_da.mArray = nullptr;
 }
 
+// A heap allocator that counts how many times it is asked for memory
+template<typename Type>
+struct CountingAllocator : HeapAllocator<Type> {
+	static size_t allocations;
+
+	Type* allocate(size_t _count) {
+		++allocations;
+		return HeapAllocator<Type>::allocate(_count);
+	}
+};
+
+template<typename Type>
+size_t CountingAllocator<Type>::allocations = 0;
+
 #pragma region Test - Default Constructor (No Arguments)
 #if LAB1_DEFAULT_CONSTRUCTOR_NO_ARGS
 void UnitTests_Lab1::Battery_DefaultConstructorNoArgs() {
@@ -1676,7 +1721,8 @@ FailResult UnitTests_Lab1::Fail_Clear_Array_MemoryIsNotDeleted() {
 }
 
 FailResult UnitTests_Lab1::Fail_Clear_Array_NotDeletedWithBrackets() {
-	bool deletedWithBrackets = SearchFile("DynArray.h", "void Clear()", "// Overloaded [] operator", "delete[] mArray");
+	bool deletedWithBrackets = SearchFile("DynArray.h", "void Clear()", "// Overloaded [] operator", "delete[] mArray") ||
+		SearchFile("DynArray.h", "void Clear()", "// Overloaded [] operator", "Release()");
 
 	FailResult result;
 	result.check = deletedWithBrackets == false;
@@ -2400,4 +2446,1080 @@ bool UnitTests_Lab1::Pass_CopyConstructor_Size_IsCorrectValue() {
 #pragma endregion
 #endif
 #pragma endregion
+
+#pragma region Test - Move Semantics
+#if LAB1_MOVE_SEMANTICS
+void UnitTests_Lab1::Battery_MoveSemantics() {
+	FailVector failVec;
+	failVec.push_back(Fail_MoveSemantics_MemoryIsAllocated);
+	failVec.push_back(Fail_MoveSemantics_ArrayIsNotTransferred);
+	failVec.push_back(Fail_MoveSemantics_ArgumentIsNotEmpty);
+
+	PassVector passVec;
+	passVec.push_back(Pass_MoveSemantics_NoMemoryAllocated);
+	passVec.push_back(Pass_MoveSemantics_ArrayIsTransferred);
+	passVec.push_back(Pass_MoveSemantics_ArgumentIsEmpty);
+
+	UnitTestBattery("Testing move constructor and move assignment", failVec, passVec);
+}
+
+#pragma region Fail Tests
+FailResult UnitTests_Lab1::Fail_MoveSemantics_MemoryIsAllocated() {
+	int randomSize = RandomInt(2, 10);
+	int* randomVals = CreateRandomArray(randomSize);
+
+	DynArray<int> moveFrom;
+	PopulateDynArray(moveFrom, randomVals, randomSize, randomSize);
+	DynArray<int> assignTo;
+
+	size_t memoryDeltaStart = inUse;
+	DynArray<int> moveTo = std::move(moveFrom);
+	assignTo = std::move(moveTo);
+	size_t memoryDeltaEnd = inUse;
+
+	FailResult result;
+	result.check = memoryDeltaEnd != memoryDeltaStart;
+	result.msg = "Memory was allocated while moving";
+
+	return result;
+}
+
+FailResult UnitTests_Lab1::Fail_MoveSemantics_ArrayIsNotTransferred() {
+	int randomSize = RandomInt(2, 10);
+	int* randomVals = CreateRandomArray(randomSize);
+
+	DynArray<int> moveFrom;
+	PopulateDynArray(moveFrom, randomVals, randomSize, randomSize);
+	DynArray<int> assignTo;
+
+	DynArray<int> moveTo = std::move(moveFrom);
+	assignTo = std::move(moveTo);
+
+	FailResult result;
+	result.check = assignTo.mArray != randomVals || assignTo.mSize != randomSize || assignTo.mCapacity != randomSize;
+	result.msg = "Array was not handed over to the invoking object";
+
+	return result;
+}
+
+FailResult UnitTests_Lab1::Fail_MoveSemantics_ArgumentIsNotEmpty() {
+	int randomSize = RandomInt(2, 10);
+	int* randomVals = CreateRandomArray(randomSize);
+
+	DynArray<int> moveFrom;
+	PopulateDynArray(moveFrom, randomVals, randomSize, randomSize);
+	DynArray<int> assignTo;
+
+	DynArray<int> moveTo = std::move(moveFrom);
+	assignTo = std::move(moveTo);
+
+	FailResult result;
+	result.check = moveFrom.mArray != nullptr || moveFrom.mSize != 0 || moveFrom.mCapacity != 0 ||
+		moveTo.mArray != nullptr || moveTo.mSize != 0 || moveTo.mCapacity != 0;
+	result.msg = "Moved-from object still holds the array";
+
+	// Preventing crash
+	if (result.check)
+		moveFrom.mArray = moveTo.mArray = nullptr;
+
+	return result;
+}
+#pragma endregion
+
+#pragma region Pass Tests
+bool UnitTests_Lab1::Pass_MoveSemantics_NoMemoryAllocated() {
+	int randomSize = RandomInt(2, 10);
+	int* randomVals = CreateRandomArray(randomSize);
+
+	DynArray<int> moveFrom;
+	PopulateDynArray(moveFrom, randomVals, randomSize, randomSize);
+	DynArray<int> assignTo;
+
+	size_t memoryDeltaStart = inUse;
+	DynArray<int> moveTo = std::move(moveFrom);
+	assignTo = std::move(moveTo);
+	size_t memoryDeltaEnd = inUse;
+
+	bool result = memoryDeltaEnd == memoryDeltaStart;
+
+	return result;
+}
+
+bool UnitTests_Lab1::Pass_MoveSemantics_ArrayIsTransferred() {
+	int randomSize = RandomInt(2, 10);
+	int* randomVals = CreateRandomArray(randomSize);
+
+	DynArray<int> moveFrom;
+	PopulateDynArray(moveFrom, randomVals, randomSize, randomSize);
+	DynArray<int> assignTo;
+
+	DynArray<int> moveTo = std::move(moveFrom);
+	assignTo = std::move(moveTo);
+
+	bool result = assignTo.mArray == randomVals && assignTo.mSize == randomSize && assignTo.mCapacity == randomSize;
+
+	return result;
+}
+
+bool UnitTests_Lab1::Pass_MoveSemantics_ArgumentIsEmpty() {
+	int randomSize = RandomInt(2, 10);
+	int* randomVals = CreateRandomArray(randomSize);
+
+	DynArray<int> moveFrom;
+	PopulateDynArray(moveFrom, randomVals, randomSize, randomSize);
+	DynArray<int> assignTo;
+
+	DynArray<int> moveTo = std::move(moveFrom);
+	assignTo = std::move(moveTo);
+
+	bool result = moveFrom.mArray == nullptr && moveFrom.mSize == 0 && moveFrom.mCapacity == 0 &&
+		moveTo.mArray == nullptr && moveTo.mSize == 0 && moveTo.mCapacity == 0;
+
+	return result;
+}
+#pragma endregion
+#endif
+#pragma endregion
+
+#pragma region Test - Allocators
+#if LAB1_ALLOCATORS
+void UnitTests_Lab1::Battery_Allocators() {
+	FailVector failVec;
+	failVec.push_back(Fail_Allocators_ArenaAllocatesPerGrowth);
+	failVec.push_back(Fail_Allocators_ClearFreesToHeap);
+	failVec.push_back(Fail_Allocators_ReleaseLeaksBlocks);
+	failVec.push_back(Fail_Allocators_PmrUsesGlobalHeap);
+
+	PassVector passVec;
+	passVec.push_back(Pass_Allocators_HeapAllocatorIsTracked);
+	passVec.push_back(Pass_Allocators_ArenaKeepsValues);
+	passVec.push_back(Pass_Allocators_ArenaReusableAfterRelease);
+	passVec.push_back(Pass_Allocators_PmrArrayInBuffer);
+
+	UnitTestBattery("Testing arena, pmr and heap allocators", failVec, passVec);
+}
+
+#pragma region Fail Tests
+FailResult UnitTests_Lab1::Fail_Allocators_ArenaAllocatesPerGrowth() {
+	int randomSize = RandomInt(100, 1000);
+
+	// The first block is big enough for every growth, so only the first Append should touch the heap
+	Arena arena(1 << 16);
+	DynArray<int, ArenaAllocator<int>> array(0, ArenaAllocator<int>(arena));
+	array.Append(0);
+
+	size_t memoryDeltaStart = inUse;
+	for (int i = 1; i < randomSize; ++i)
+		array.Append(i);
+	size_t memoryDeltaEnd = inUse;
+
+	FailResult result;
+	result.check = memoryDeltaEnd != memoryDeltaStart;
+	result.msg = "Growing an arena-backed array allocated from the heap again";
+
+	return result;
+}
+
+FailResult UnitTests_Lab1::Fail_Allocators_ClearFreesToHeap() {
+	int randomSize = RandomInt(100, 1000);
+
+	Arena arena;
+	DynArray<int, ArenaAllocator<int>> array(0, ArenaAllocator<int>(arena));
+	for (int i = 0; i < randomSize; ++i)
+		array.Append(i);
+
+	size_t memoryDeltaStart = inUse;
+	array.Clear();
+	size_t memoryDeltaEnd = inUse;
+
+	FailResult result;
+	result.check = memoryDeltaEnd != memoryDeltaStart;
+	result.msg = "Clearing an arena-backed array returned memory to the heap";
+
+	return result;
+}
+
+FailResult UnitTests_Lab1::Fail_Allocators_ReleaseLeaksBlocks() {
+	int randomSize = RandomInt(1000, 10000);
+
+	size_t memoryDeltaStart = inUse;
+	Arena arena(64);
+	{
+		// A small first block forces the arena to chain several blocks
+		DynArray<int, ArenaAllocator<int>> array(0, ArenaAllocator<int>(arena));
+		for (int i = 0; i < randomSize; ++i)
+			array.Append(i);
+	}
+	arena.Release();
+	size_t memoryDeltaEnd = inUse;
+
+	FailResult result;
+	result.check = memoryDeltaEnd != memoryDeltaStart;
+	result.msg = "Releasing the arena did not free every block";
+
+	return result;
+}
+
+FailResult UnitTests_Lab1::Fail_Allocators_PmrUsesGlobalHeap() {
+	int randomSize = RandomInt(100, 1000);
+
+	alignas(std::max_align_t) char buffer[16384];
+	std::pmr::monotonic_buffer_resource resource(buffer, sizeof(buffer));
+
+	size_t memoryDeltaStart = inUse;
+	{
+		pmr::DynArray<int> array(0, &resource);
+		for (int i = 0; i < randomSize; ++i)
+			array.Append(i);
+	}
+	size_t memoryDeltaEnd = inUse;
+
+	FailResult result;
+	result.check = memoryDeltaEnd != memoryDeltaStart;
+	result.msg = "pmr::DynArray over a stack buffer allocated from the global heap";
+
+	return result;
+}
+#pragma endregion
+
+#pragma region Pass Tests
+bool UnitTests_Lab1::Pass_Allocators_HeapAllocatorIsTracked() {
+	int randomSize = RandomInt(2, 10);
+
+	// A buffer from new[] has to be releasable through the allocator, as PopulateDynArray relies on
+	HeapAllocator<int> allocator;
+	size_t memoryDeltaStart = inUse;
+	int* storage = allocator.allocate(randomSize);
+	bool allocated = inUse - memoryDeltaStart == randomSize * sizeof(int);
+	allocator.deallocate(storage, randomSize);
+
+	int* values = new int[randomSize];
+	allocator.deallocate(values, randomSize);
+	size_t memoryDeltaEnd = inUse;
+
+	bool result = allocated && memoryDeltaEnd == memoryDeltaStart;
+
+	return result;
+}
+
+bool UnitTests_Lab1::Pass_Allocators_ArenaKeepsValues() {
+	int randomSize = RandomInt(100, 1000);
+	int* randomVals = CreateRandomArray(randomSize);
+
+	Arena arena(64);
+	DynArray<int, ArenaAllocator<int>> array(0, ArenaAllocator<int>(arena));
+	for (int i = 0; i < randomSize; ++i)
+		array.Append(randomVals[i]);
+
+	bool result = array.Size() == (size_t)randomSize;
+	for (int i = 0; i < randomSize && result; ++i)
+		result = array[i] == randomVals[i];
+
+	delete[] randomVals;
+
+	return result;
+}
+
+bool UnitTests_Lab1::Pass_Allocators_ArenaReusableAfterRelease() {
+	int randomSize = RandomInt(100, 1000);
+
+	size_t memoryDeltaStart = inUse;
+	Arena arena;
+	bool result = true;
+
+	// The same arena serves a second array once the first one's memory is released
+	for (int round = 0; round < 2 && result; ++round)
+	{
+		{
+			DynArray<int, ArenaAllocator<int>> array(0, ArenaAllocator<int>(arena));
+			for (int i = 0; i < randomSize; ++i)
+				array.Append(i * round);
+
+			result = array.Size() == (size_t)randomSize && array[randomSize - 1] == (randomSize - 1) * round;
+		}
+		arena.Release();
+		result = result && inUse == memoryDeltaStart;
+	}
+
+	return result;
+}
+
+bool UnitTests_Lab1::Pass_Allocators_PmrArrayInBuffer() {
+	int randomSize = RandomInt(100, 1000);
+
+	alignas(std::max_align_t) char buffer[16384];
+	std::pmr::monotonic_buffer_resource resource(buffer, sizeof(buffer));
+
+	pmr::DynArray<int> array(0, &resource);
+	for (int i = 0; i < randomSize; ++i)
+		array.Append(i);
+
+	const char* first = reinterpret_cast<const char*>(&array[0]);
+	const char* last = reinterpret_cast<const char*>(&array[randomSize - 1]);
+
+	bool result = first >= buffer && last < buffer + sizeof(buffer) && array[randomSize - 1] == randomSize - 1;
+
+	return result;
+}
+#pragma endregion
+#endif
+#pragma endregion
+
+#pragma region Test - Small Array
+#if LAB1_SMALL_ARRAY
+// Checks if an address is inside an object (meaning it is in the inline storage)
+//
+// In:	_address			The address to check
+//		_object				The object to look in
+//
+// Return: True if the address is part of the object
+template<typename Type>
+static bool IsInsideObject(const void* _address, const Type& _object) {
+	const char* address = static_cast<const char*>(_address);
+	const char* object = reinterpret_cast<const char*>(&_object);
+
+	return address >= object && address < object + sizeof(Type);
+}
+
+void UnitTests_Lab1::Battery_SmallArray() {
+	FailVector failVec;
+	failVec.push_back(Fail_SmallArray_InlineAppendAllocates);
+	failVec.push_back(Fail_SmallArray_SpillLosesValues);
+	failVec.push_back(Fail_SmallArray_MoveTakesInlineBuffer);
+
+	PassVector passVec;
+	passVec.push_back(Pass_SmallArray_EmptyUsesInlineBuffer);
+	passVec.push_back(Pass_SmallArray_SpillAllocatesOnce);
+	passVec.push_back(Pass_SmallArray_MoveMovesElements);
+
+	UnitTestBattery("Testing SmallDynArray inline storage", failVec, passVec);
+}
+
+#pragma region Fail Tests
+FailResult UnitTests_Lab1::Fail_SmallArray_InlineAppendAllocates() {
+	SmallDynArray<int, 16> array;
+
+	size_t memoryDeltaStart = inUse;
+	for (int i = 0; i < 16; ++i)
+		array.Append(RandomInt(0, 100));
+	size_t memoryDeltaEnd = inUse;
+
+	FailResult result;
+	result.check = memoryDeltaEnd != memoryDeltaStart;
+	result.msg = "Appending within the inline capacity allocated memory";
+
+	return result;
+}
+
+FailResult UnitTests_Lab1::Fail_SmallArray_SpillLosesValues() {
+	int randomSize = RandomInt(9, 40);
+	int* randomVals = CreateRandomArray(randomSize);
+
+	SmallDynArray<int, 8> array;
+	for (int i = 0; i < randomSize; ++i)
+		array.Append(randomVals[i]);
+
+	FailResult result;
+	result.check = array.mSize != randomSize;
+	for (int i = 0; i < randomSize && !result.check; ++i)
+		result.check = array.mArray[i] != randomVals[i];
+	result.msg = "Values were lost or reordered when spilling past the inline capacity";
+
+	delete[] randomVals;
+
+	return result;
+}
+
+FailResult UnitTests_Lab1::Fail_SmallArray_MoveTakesInlineBuffer() {
+	SmallDynArray<int, 8> moveFrom;
+	for (int i = 0; i < 5; ++i)
+		moveFrom.Append(i);
+
+	SmallDynArray<int, 8> moveTo(std::move(moveFrom));
+
+	FailResult result;
+	result.check = !IsInsideObject(moveTo.mArray, moveTo) || IsInsideObject(moveTo.mArray, moveFrom) ||
+		!IsInsideObject(moveFrom.mArray, moveFrom);
+	result.msg = "Moving an inline array took the other object's inline buffer";
+
+	// Preventing crash
+	if (result.check)
+	{
+		moveTo.mArray = moveFrom.mArray = nullptr;
+		moveTo.mSize = moveFrom.mSize = 0;
+	}
+
+	return result;
+}
+#pragma endregion
+
+#pragma region Pass Tests
+bool UnitTests_Lab1::Pass_SmallArray_EmptyUsesInlineBuffer() {
+	SmallDynArray<int, 8> array;
+	bool result = array.Capacity() == 8 && IsInsideObject(array.mArray, array);
+
+	// Clear goes back to the inline buffer after a spill
+	for (int i = 0; i < 20; ++i)
+		array.Append(i);
+	result = result && !IsInsideObject(array.mArray, array);
+
+	array.Clear();
+	result = result && array.Capacity() == 8 && array.Size() == 0 && IsInsideObject(array.mArray, array);
+
+	return result;
+}
+
+bool UnitTests_Lab1::Pass_SmallArray_SpillAllocatesOnce() {
+	SmallDynArray<int, 8> array;
+	for (int i = 0; i < 8; ++i)
+		array.Append(i);
+
+	// The ninth value is the only one that needs the heap, and it gets one doubled block
+	size_t memoryDeltaStart = inUse;
+	array.Append(8);
+	size_t memoryDeltaEnd = inUse;
+
+	bool result = memoryDeltaEnd - memoryDeltaStart == 16 * sizeof(int) && array.Capacity() == 16;
+	for (int i = 0; i < 9 && result; ++i)
+		result = array[i] == i;
+
+	return result;
+}
+
+bool UnitTests_Lab1::Pass_SmallArray_MoveMovesElements() {
+	// Long enough to live on the heap, so a moved string keeps its buffer
+	std::string text(64, 'x');
+
+	SmallDynArray<std::string, 4> moveFrom;
+	for (int i = 0; i < 3; ++i)
+		moveFrom.Append(text + std::to_string(i));
+
+	const char* buffers[3];
+	for (int i = 0; i < 3; ++i)
+		buffers[i] = moveFrom[i].data();
+
+	SmallDynArray<std::string, 4> moveTo;
+	moveTo = std::move(moveFrom);
+
+	bool result = moveTo.Size() == 3 && moveFrom.Size() == 0 && IsInsideObject(moveTo.mArray, moveTo);
+	for (int i = 0; i < 3 && result; ++i)
+		result = moveTo[i].data() == buffers[i] && moveTo[i] == text + std::to_string(i);
+
+	return result;
+}
+#pragma endregion
+#endif
+#pragma endregion
+
+#pragma region Test - Growth Policy
+#if LAB1_GROWTH_POLICY
+// Append values one at a time and record every capacity the array goes through
+//
+// In:	_count				The number of values to append
+//
+// Return: The capacities in the order they were reached
+template<typename Array>
+static std::vector<size_t> CapacitySequence(int _count) {
+	Array array;
+	std::vector<size_t> capacities;
+
+	for (int i = 0; i < _count; ++i)
+	{
+		array.Append(i);
+		if (capacities.empty() || capacities.back() != array.Capacity())
+			capacities.push_back(array.Capacity());
+	}
+
+	return capacities;
+}
+
+void UnitTests_Lab1::Battery_GrowthPolicy() {
+	FailVector failVec;
+	failVec.push_back(Fail_GrowthPolicy_WrongDoublingSequence);
+	failVec.push_back(Fail_GrowthPolicy_WrongHalfSequence);
+	failVec.push_back(Fail_GrowthPolicy_WrongChunkSequence);
+	failVec.push_back(Fail_GrowthPolicy_ReserveExactWrongCapacity);
+	failVec.push_back(Fail_GrowthPolicy_ShrinkToFitLosesValues);
+
+	PassVector passVec;
+	passVec.push_back(Pass_GrowthPolicy_ReserveUsesPolicy);
+	passVec.push_back(Pass_GrowthPolicy_ShrinkToFitReturnsMemory);
+	passVec.push_back(Pass_GrowthPolicy_ReserveExactKeepsSize);
+
+	UnitTestBattery("Testing growth policies, ReserveExact and ShrinkToFit", failVec, passVec);
+}
+
+#pragma region Fail Tests
+FailResult UnitTests_Lab1::Fail_GrowthPolicy_WrongDoublingSequence() {
+	std::vector<size_t> expected = { 1, 2, 4, 8, 16, 32, 64, 128 };
+
+	FailResult result;
+	result.check = CapacitySequence<DynArray<int>>(100) != expected;
+	result.msg = "DoublingGrowth did not go 1, 2, 4, 8, ...";
+
+	return result;
+}
+
+FailResult UnitTests_Lab1::Fail_GrowthPolicy_WrongHalfSequence() {
+	std::vector<size_t> expected = { 1, 2, 3, 4, 6, 9, 13, 19, 28, 42, 63, 94, 141 };
+
+	FailResult result;
+	result.check = CapacitySequence<DynArray<int, HeapAllocator<int>, 0, HalfGrowth>>(100) != expected;
+	result.msg = "HalfGrowth did not grow by half the capacity";
+
+	return result;
+}
+
+FailResult UnitTests_Lab1::Fail_GrowthPolicy_WrongChunkSequence() {
+	std::vector<size_t> expected = { 10, 20, 30, 40, 50 };
+
+	FailResult result;
+	result.check = CapacitySequence<DynArray<int, HeapAllocator<int>, 0, ChunkGrowth<10>>>(45) != expected;
+	result.msg = "ChunkGrowth<10> did not grow 10 elements at a time";
+
+	return result;
+}
+
+FailResult UnitTests_Lab1::Fail_GrowthPolicy_ReserveExactWrongCapacity() {
+	int randomSize = RandomInt(2, 10);
+	size_t larger = randomSize + RandomInt(3, 50);
+
+	DynArray<int> array;
+	for (int i = 0; i < randomSize; ++i)
+		array.Append(i);
+
+	// Growing to an odd capacity and shrinking back must both be exact
+	array.ReserveExact(larger);
+	size_t grown = array.Capacity();
+	array.ReserveExact(randomSize + 1);
+	size_t shrunk = array.Capacity();
+
+	FailResult result;
+	result.check = grown != larger || shrunk != (size_t)randomSize + 1;
+	result.msg = "ReserveExact did not set the capacity to exactly the requested value";
+
+	return result;
+}
+
+FailResult UnitTests_Lab1::Fail_GrowthPolicy_ShrinkToFitLosesValues() {
+	int randomSize = RandomInt(5, 100);
+	int* randomVals = CreateRandomArray(randomSize);
+
+	DynArray<int> array;
+	for (int i = 0; i < randomSize; ++i)
+		array.Append(randomVals[i]);
+	array.ShrinkToFit();
+
+	FailResult result;
+	result.check = array.mSize != randomSize;
+	for (int i = 0; i < randomSize && !result.check; ++i)
+		result.check = array.mArray[i] != randomVals[i];
+	result.msg = "ShrinkToFit lost or reordered values";
+
+	delete[] randomVals;
+
+	return result;
+}
+#pragma endregion
+
+#pragma region Pass Tests
+bool UnitTests_Lab1::Pass_GrowthPolicy_ReserveUsesPolicy() {
+	DynArray<int, HeapAllocator<int>, 0, HalfGrowth> half(4);
+	half.Reserve();
+
+	DynArray<int, HeapAllocator<int>, 0, ChunkGrowth<7>> chunk(3);
+	chunk.Reserve();
+
+	bool result = half.Capacity() == 6 && chunk.Capacity() == 10;
+
+	return result;
+}
+
+bool UnitTests_Lab1::Pass_GrowthPolicy_ShrinkToFitReturnsMemory() {
+	int randomSize = RandomInt(5, 100);
+
+	DynArray<int> array(256);
+	for (int i = 0; i < randomSize; ++i)
+		array.Append(i);
+
+	size_t memoryDeltaStart = inUse;
+	array.ShrinkToFit();
+	size_t memoryDeltaEnd = inUse;
+
+	bool result = array.Capacity() == (size_t)randomSize &&
+		memoryDeltaStart - memoryDeltaEnd == (256 - randomSize) * sizeof(int);
+
+	// An empty array gives back everything
+	array.Clear();
+	array.Reserve(10);
+	array.ShrinkToFit();
+	result = result && array.Capacity() == 0 && array.mArray == nullptr;
+
+	return result;
+}
+
+bool UnitTests_Lab1::Pass_GrowthPolicy_ReserveExactKeepsSize() {
+	int randomSize = RandomInt(10, 20);
+
+	DynArray<int> array;
+	for (int i = 0; i < randomSize; ++i)
+		array.Append(i);
+
+	// Asking for less than the size stops at the size
+	array.ReserveExact(randomSize / 2);
+	bool result = array.Capacity() == (size_t)randomSize && array[randomSize - 1] == randomSize - 1;
+
+	// A small array that fits its inline capacity goes back inside the object
+	SmallDynArray<int, 8> small;
+	for (int i = 0; i < 12; ++i)
+		small.Append(i);
+	small.EraseIf([](int _value) { return _value >= 4; });
+	small.ShrinkToFit();
+	result = result && small.Capacity() == 8 && small.mArray == small.InlineData() && small[3] == 3;
+
+	return result;
+}
+#pragma endregion
+#endif
+#pragma endregion
+
+#pragma region Test - Bulk Operations
+#if LAB1_BULK_OPERATIONS
+// Checks if a DynArray holds the same values as a vector, in the same order
+//
+// In:	_array				The DynArray to check
+//		_expected			The values it should hold
+//
+// Return: True if the values match
+template<typename Array, typename Type>
+static bool MatchesVector(Array& _array, const std::vector<Type>& _expected) {
+	if (_array.Size() != _expected.size())
+		return false;
+
+	for (size_t i = 0; i < _expected.size(); ++i)
+		if (_array[i] != _expected[i])
+			return false;
+
+	return true;
+}
+
+void UnitTests_Lab1::Battery_BulkOperations() {
+	FailVector failVec;
+	failVec.push_back(Fail_BulkOperations_AppendRangeAllocatesMoreThanOnce);
+	failVec.push_back(Fail_BulkOperations_InsertAllocatesMoreThanOnce);
+	failVec.push_back(Fail_BulkOperations_InsertWrongOrder);
+	failVec.push_back(Fail_BulkOperations_SelfInsertCorrupts);
+	failVec.push_back(Fail_BulkOperations_EraseIfAllocates);
+
+	PassVector passVec;
+	passVec.push_back(Pass_BulkOperations_IndexPastEndIgnored);
+	passVec.push_back(Pass_BulkOperations_EmptyRangeIgnored);
+	passVec.push_back(Pass_BulkOperations_EraseIfKeepsOrder);
+
+	UnitTestBattery("Testing AppendRange, ranged Insert and EraseIf", failVec, passVec);
+}
+
+#pragma region Fail Tests
+FailResult UnitTests_Lab1::Fail_BulkOperations_AppendRangeAllocatesMoreThanOnce() {
+	// Bulk load the numbers.bin payload
+	std::ifstream ifl("Files\\numbers.bin", std::ios::binary);
+	int size = 0;
+	ifl.read((char*)&size, sizeof(int));
+	std::vector<int> payload(size > 0 ? size : 0);
+	ifl.read((char*)payload.data(), payload.size() * sizeof(int));
+
+	DynArray<int, CountingAllocator<int>> array;
+	CountingAllocator<int>::allocations = 0;
+
+	size_t memoryDeltaStart = inUse;
+	array.AppendRange(payload.data(), payload.size());
+	size_t memoryDeltaEnd = inUse;
+
+	FailResult result;
+	result.check = payload.empty() || CountingAllocator<int>::allocations != 1 ||
+		memoryDeltaEnd - memoryDeltaStart != payload.size() * sizeof(int) || !MatchesVector(array, payload);
+	result.msg = "AppendRange did not load numbers.bin with a single allocation of the exact size";
+
+	return result;
+}
+
+FailResult UnitTests_Lab1::Fail_BulkOperations_InsertAllocatesMoreThanOnce() {
+	int randomSize = RandomInt(2, 10);
+	int randomCount = RandomInt(1, 30);
+	int* randomVals = CreateRandomArray(randomCount);
+
+	DynArray<int, CountingAllocator<int>> array(randomSize);
+	for (int i = 0; i < randomSize; ++i)
+		array.Append(i);
+	CountingAllocator<int>::allocations = 0;
+
+	array.Insert(randomSize / 2, randomVals, randomVals + randomCount);
+	size_t expectedCapacity = randomSize * 2 > randomSize + randomCount ? randomSize * 2 : randomSize + randomCount;
+
+	FailResult result;
+	result.check = CountingAllocator<int>::allocations != 1 || array.Capacity() != expectedCapacity;
+	result.msg = "Insert into a full array did not grow it exactly once";
+
+	delete[] randomVals;
+
+	return result;
+}
+
+FailResult UnitTests_Lab1::Fail_BulkOperations_InsertWrongOrder() {
+	int randomSize = RandomInt(2, 20);
+	int randomCount = RandomInt(1, 20);
+	int* randomVals = CreateRandomArray(randomCount);
+	size_t randomIndex = RandomInt(0, randomSize);
+
+	std::vector<int> expected;
+	DynArray<int> array(64);
+	for (int i = 0; i < randomSize; ++i)
+	{
+		array.Append(i);
+		expected.push_back(i);
+	}
+
+	// Inserting within the capacity shifts the tail in place
+	array.Insert(randomIndex, randomVals, randomVals + randomCount);
+	expected.insert(expected.begin() + randomIndex, randomVals, randomVals + randomCount);
+
+	FailResult result;
+	result.check = !MatchesVector(array, expected);
+	result.msg = "Insert put the values in the wrong place or lost part of the tail";
+
+	delete[] randomVals;
+
+	return result;
+}
+
+FailResult UnitTests_Lab1::Fail_BulkOperations_SelfInsertCorrupts() {
+	std::vector<std::string> expected;
+	DynArray<std::string> roomy(64), full(8);
+	for (int i = 0; i < 8; ++i)
+	{
+		expected.push_back(std::to_string(i));
+		roomy.Append(expected.back());
+		full.Append(expected.back());
+	}
+
+	// The range overlaps the part of the array that gets shifted, with and without growing
+	roomy.Insert(2, &roomy[1], &roomy[6]);
+	full.Insert(3, &full[0], &full[0] + 8);
+
+	std::vector<std::string> expectedRoomy = expected, expectedFull = expected;
+	expectedRoomy.insert(expectedRoomy.begin() + 2, expected.begin() + 1, expected.begin() + 6);
+	expectedFull.insert(expectedFull.begin() + 3, expected.begin(), expected.end());
+
+	FailResult result;
+	result.check = !MatchesVector(roomy, expectedRoomy) || !MatchesVector(full, expectedFull);
+	result.msg = "Inserting a range taken from the array itself corrupted the values";
+
+	return result;
+}
+
+FailResult UnitTests_Lab1::Fail_BulkOperations_EraseIfAllocates() {
+	int randomSize = RandomInt(10, 100);
+
+	DynArray<int, CountingAllocator<int>> array;
+	for (int i = 0; i < randomSize; ++i)
+		array.Append(i);
+	size_t capacity = array.Capacity();
+	CountingAllocator<int>::allocations = 0;
+
+	size_t memoryDeltaStart = inUse;
+	array.EraseIf([](int _value) { return _value % 3 == 0; });
+	size_t memoryDeltaEnd = inUse;
+
+	FailResult result;
+	result.check = CountingAllocator<int>::allocations != 0 || memoryDeltaEnd != memoryDeltaStart ||
+		array.Capacity() != capacity;
+	result.msg = "EraseIf allocated or resized the array instead of compacting it in place";
+
+	return result;
+}
+#pragma endregion
+
+#pragma region Pass Tests
+bool UnitTests_Lab1::Pass_BulkOperations_IndexPastEndIgnored() {
+	int randomSize = RandomInt(2, 10);
+	int values[] = { 1, 2, 3 };
+
+	DynArray<int> array;
+	for (int i = 0; i < randomSize; ++i)
+		array.Append(i);
+	size_t capacity = array.Capacity();
+
+	size_t memoryDeltaStart = inUse;
+	array.Insert(randomSize + 1, values, values + 3);
+	size_t memoryDeltaEnd = inUse;
+
+	bool result = array.Size() == (size_t)randomSize && array.Capacity() == capacity && memoryDeltaEnd == memoryDeltaStart;
+
+	// Inserting exactly at the end is the same as AppendRange
+	array.Insert(randomSize, values, values + 3);
+	result = result && array.Size() == (size_t)randomSize + 3 && array[randomSize + 2] == 3;
+
+	return result;
+}
+
+bool UnitTests_Lab1::Pass_BulkOperations_EmptyRangeIgnored() {
+	int values[] = { 1 };
+
+	DynArray<int> array;
+	size_t memoryDeltaStart = inUse;
+	array.AppendRange(values, 0);
+	array.Insert(0, values, values);
+	size_t memoryDeltaEnd = inUse;
+
+	bool result = array.Size() == 0 && array.Capacity() == 0 && memoryDeltaEnd == memoryDeltaStart;
+
+	return result;
+}
+
+bool UnitTests_Lab1::Pass_BulkOperations_EraseIfKeepsOrder() {
+	std::vector<std::string> expected;
+	DynArray<std::string> array;
+	for (int i = 0; i < 50; ++i)
+	{
+		array.Append(std::to_string(i));
+		if (i % 4 != 0)
+			expected.push_back(std::to_string(i));
+	}
+
+	size_t removed = array.EraseIf([](const std::string& _value) { return std::stoi(_value) % 4 == 0; });
+
+	bool result = removed == 13 && MatchesVector(array, expected);
+
+	return result;
+}
+#pragma endregion
+#endif
+#pragma endregion
+
+#pragma region Benchmark - Move-Aware Append
+#if LAB1_APPEND_BENCHMARK
+// A string that counts how many times it is copied
+//		NoexceptMove decides whether growth can move it (like std::string) or has to
+//		copy it (which is what every growth did before DynArray was move-aware)
+template<bool NoexceptMove>
+struct CountedString {
+	static size_t copies;
+	std::string text;
+
+	CountedString(const std::string& _text) : text(_text) {}
+	CountedString(const CountedString& _copy) : text(_copy.text) { ++copies; }
+	CountedString(CountedString&& _move) noexcept(NoexceptMove) : text(std::move(_move.text)) {}
+
+	CountedString& operator=(const CountedString& _assign) {
+		text = _assign.text;
+		++copies;
+		return *this;
+	}
+
+	CountedString& operator=(CountedString&& _assign) noexcept(NoexceptMove) {
+		text = std::move(_assign.text);
+		return *this;
+	}
+};
+
+template<bool NoexceptMove>
+size_t CountedString<NoexceptMove>::copies = 0;
+
+// Append strings one at a time and print the time, the number of string copies
+// and the number of times the array grew
+//		The strings are too long for the small string buffer, so every copy is a heap allocation
+//
+// In:	_name			What to call this run
+//		_count			The number of strings to append
+template<bool NoexceptMove>
+static void BenchmarkAppendStrings(const char* _name, size_t _count) {
+	const std::string text(32, 'x');
+	size_t growths = 0;
+	CountedString<NoexceptMove>::copies = 0;
+
+	auto start = std::chrono::steady_clock::now();
+	{
+		DynArray<CountedString<NoexceptMove>> array;
+		for (size_t i = 0; i < _count; ++i) {
+			size_t capacity = array.Capacity();
+			array.Append(CountedString<NoexceptMove>(text));
+			growths += array.Capacity() != capacity;
+		}
+	}
+	auto end = std::chrono::steady_clock::now();
+
+	std::cout << "  " << _name << ": " << std::chrono::duration<double, std::milli>(end - start).count() << " ms, "
+		<< CountedString<NoexceptMove>::copies << " copies (heap allocations), " << growths << " growths\n";
+}
+
+// Times appending 10 million strings when growth moves the elements,
+// and when it has to copy them
+void UnitTests_Lab1::Benchmark_MoveAwareAppend() {
+	const size_t count = 10000000;
+	std::cout << "Benchmarking DynArray::Append with " << count << " strings\n";
+
+	BenchmarkAppendStrings<true>("Growth moves the strings", count);
+	BenchmarkAppendStrings<false>("Growth copies the strings", count);
+}
+#endif
+#pragma endregion
+
+#pragma region Benchmark - Trivially Copyable Growth
+#if LAB1_TRIVIAL_COPY_BENCHMARK
+// An int with its own copy constructor, so DynArray can not use memcpy for it
+struct CopiedInt {
+	int value;
+
+	CopiedInt(int _value) : value(_value) {}
+	CopiedInt(const CopiedInt& _copy) : value(_copy.value) {}
+	CopiedInt& operator=(const CopiedInt& _assign) { value = _assign.value; return *this; }
+};
+
+// Append the same payload over and over until the array holds _count values, then copy the array
+// and print how long both took
+//
+// In:	_name			What to call this run
+//		_payload		The values to append
+//		_count			The number of values to end up with
+template<typename Type>
+static void BenchmarkIngest(const char* _name, const std::vector<int>& _payload, size_t _count) {
+	auto start = std::chrono::steady_clock::now();
+	DynArray<Type> array;
+	for (size_t i = 0; i < _count; ++i)
+		array.Append(Type(_payload[i % _payload.size()]));
+	auto appended = std::chrono::steady_clock::now();
+
+	DynArray<Type> copy;
+	copy = array;
+	auto end = std::chrono::steady_clock::now();
+
+	std::cout << "  " << _name << ": append " << std::chrono::duration<double, std::milli>(appended - start).count()
+		<< " ms, copy " << std::chrono::duration<double, std::milli>(end - appended).count() << " ms\n";
+}
+
+// Times ingesting the numbers.bin payload (repeated up to 50 million ints) into
+// a DynArray of ints, which grows and copies with memcpy, and into a DynArray of
+// a non-trivially copyable int, which copies one element at a time
+void UnitTests_Lab1::Benchmark_TriviallyCopyableGrowth() {
+	const size_t count = 50000000;
+
+	std::ifstream ifl("Files\\numbers.bin", std::ios::binary);
+	int size = 0;
+	ifl.read((char*)&size, sizeof(int));
+	std::vector<int> payload(size > 0 ? size : 0);
+	ifl.read((char*)payload.data(), payload.size() * sizeof(int));
+	if (payload.empty()) {
+		std::cout << "Files\\numbers.bin did not open correctly\n";
+		return;
+	}
+
+	std::cout << "Benchmarking DynArray growth and copy with " << count << " ints from numbers.bin\n";
+	BenchmarkIngest<int>("int (memcpy)", payload, count);
+	BenchmarkIngest<CopiedInt>("CopiedInt (element by element)", payload, count);
+}
+#endif
+#pragma endregion
+
+#pragma region Benchmark - Small Arrays
+#if LAB1_SMALL_ARRAY_BENCHMARK
+// Fill a large number of arrays with 1 to 16 ints each, and print how many allocations
+// that took and how much heap memory the arrays hold onto
+//
+// In:	_name			What to call this run
+//		_count			The number of arrays to fill
+template<typename Array>
+static void BenchmarkSmallArrays(const char* _name, size_t _count) {
+	std::vector<Array> arrays;
+	arrays.reserve(_count);
+	CountingAllocator<int>::allocations = 0;
+
+	size_t memoryStart = inUse;
+	auto start = std::chrono::steady_clock::now();
+	for (size_t i = 0; i < _count; ++i)
+	{
+		arrays.emplace_back();
+		int size = RandomInt(1, 16);
+		for (int j = 0; j < size; ++j)
+			arrays.back().Append(j);
+	}
+	auto end = std::chrono::steady_clock::now();
+
+	std::cout << "  " << _name << ": " << CountingAllocator<int>::allocations << " allocations, "
+		<< (inUse - memoryStart) << " bytes on the heap, "
+		<< std::chrono::duration<double, std::milli>(end - start).count() << " ms\n";
+}
+
+// Compares plain DynArrays against SmallDynArrays for the common case of
+// arrays that never hold more than 16 elements
+void UnitTests_Lab1::Benchmark_SmallArrays() {
+	const size_t count = 1000000;
+
+	std::cout << "Benchmarking " << count << " arrays of 1 to 16 ints\n";
+	BenchmarkSmallArrays<DynArray<int, CountingAllocator<int>>>("DynArray", count);
+	BenchmarkSmallArrays<DynArray<int, CountingAllocator<int>, 16>>("SmallDynArray (16 inline)", count);
+}
+#endif
+#pragma endregion
+
+#pragma region Benchmark - Growth Policies
+#if LAB1_GROWTH_BENCHMARK
+// A heap allocator that remembers the highest value inUse reached
+//		Checked right after each allocation, while the old block is still alive
+template<typename Type>
+struct PeakAllocator : HeapAllocator<Type> {
+	static size_t peak;
+	static size_t allocations;
+
+	Type* allocate(size_t _count) {
+		Type* storage = HeapAllocator<Type>::allocate(_count);
+		++allocations;
+		if (inUse > peak) { peak = inUse; }
+		return storage;
+	}
+};
+
+template<typename Type>
+size_t PeakAllocator<Type>::peak = 0;
+template<typename Type>
+size_t PeakAllocator<Type>::allocations = 0;
+
+// Append values one at a time under a growth policy, then shrink the array,
+// and print the peak memory while growing, the allocation count and the time taken
+//
+// In:	_name			What to call this run
+//		_count			The number of values to append
+template<typename GrowthPolicy>
+static void BenchmarkGrowth(const char* _name, size_t _count) {
+	size_t memoryStart = inUse;
+	PeakAllocator<int>::peak = memoryStart;
+	PeakAllocator<int>::allocations = 0;
+
+	auto start = std::chrono::steady_clock::now();
+	DynArray<int, PeakAllocator<int>, 0, GrowthPolicy> array;
+	for (size_t i = 0; i < _count; ++i)
+		array.Append((int)i);
+	auto end = std::chrono::steady_clock::now();
+
+	size_t peak = PeakAllocator<int>::peak - memoryStart;
+	size_t grown = inUse - memoryStart;
+	array.ShrinkToFit();
+
+	std::cout << "  " << _name << ": peak " << peak << " bytes, "
+		<< grown << " bytes after growing, " << (inUse - memoryStart) << " after ShrinkToFit, "
+		<< PeakAllocator<int>::allocations << " allocations, "
+		<< std::chrono::duration<double, std::milli>(end - start).count() << " ms\n";
+}
+
+// Reports the peak inUse reached by each growth policy while appending
+// 10 million ints one at a time
+void UnitTests_Lab1::Benchmark_GrowthPolicies() {
+	const size_t count = 10000000;
+
+	std::cout << "Benchmarking growth policies with " << count << " ints\n";
+	BenchmarkGrowth<DoublingGrowth>("DoublingGrowth", count);
+	BenchmarkGrowth<HalfGrowth>("HalfGrowth", count);
+	BenchmarkGrowth<ChunkGrowth<1 << 16>>("ChunkGrowth<65536>", count);
+}
+#endif
+#pragma endregion
 #endif
\ No newline at end of file
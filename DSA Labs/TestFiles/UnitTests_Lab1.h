@@ -243,5 +243,86 @@ public:
 	static bool Pass_CopyConstructor_Size_IsCorrectValue();
 #pragma endregion
 
+#pragma region Test - Move Semantics
+	static void Battery_MoveSemantics();
+
+	static FailResult Fail_MoveSemantics_MemoryIsAllocated();
+	static FailResult Fail_MoveSemantics_ArrayIsNotTransferred();
+	static FailResult Fail_MoveSemantics_ArgumentIsNotEmpty();
+
+	static bool Pass_MoveSemantics_NoMemoryAllocated();
+	static bool Pass_MoveSemantics_ArrayIsTransferred();
+	static bool Pass_MoveSemantics_ArgumentIsEmpty();
+#pragma endregion
+
+#pragma region Test - Allocators
+	static void Battery_Allocators();
+
+	static FailResult Fail_Allocators_ArenaAllocatesPerGrowth();
+	static FailResult Fail_Allocators_ClearFreesToHeap();
+	static FailResult Fail_Allocators_ReleaseLeaksBlocks();
+	static FailResult Fail_Allocators_PmrUsesGlobalHeap();
+
+	static bool Pass_Allocators_HeapAllocatorIsTracked();
+	static bool Pass_Allocators_ArenaKeepsValues();
+	static bool Pass_Allocators_ArenaReusableAfterRelease();
+	static bool Pass_Allocators_PmrArrayInBuffer();
+#pragma endregion
+
+#pragma region Test - Small Array
+	static void Battery_SmallArray();
+
+	static FailResult Fail_SmallArray_InlineAppendAllocates();
+	static FailResult Fail_SmallArray_SpillLosesValues();
+	static FailResult Fail_SmallArray_MoveTakesInlineBuffer();
+
+	static bool Pass_SmallArray_EmptyUsesInlineBuffer();
+	static bool Pass_SmallArray_SpillAllocatesOnce();
+	static bool Pass_SmallArray_MoveMovesElements();
+#pragma endregion
+
+#pragma region Test - Growth Policy
+	static void Battery_GrowthPolicy();
+
+	static FailResult Fail_GrowthPolicy_WrongDoublingSequence();
+	static FailResult Fail_GrowthPolicy_WrongHalfSequence();
+	static FailResult Fail_GrowthPolicy_WrongChunkSequence();
+	static FailResult Fail_GrowthPolicy_ReserveExactWrongCapacity();
+	static FailResult Fail_GrowthPolicy_ShrinkToFitLosesValues();
+
+	static bool Pass_GrowthPolicy_ReserveUsesPolicy();
+	static bool Pass_GrowthPolicy_ShrinkToFitReturnsMemory();
+	static bool Pass_GrowthPolicy_ReserveExactKeepsSize();
+#pragma endregion
+
+#pragma region Test - Bulk Operations
+	static void Battery_BulkOperations();
+
+	static FailResult Fail_BulkOperations_AppendRangeAllocatesMoreThanOnce();
+	static FailResult Fail_BulkOperations_InsertAllocatesMoreThanOnce();
+	static FailResult Fail_BulkOperations_InsertWrongOrder();
+	static FailResult Fail_BulkOperations_SelfInsertCorrupts();
+	static FailResult Fail_BulkOperations_EraseIfAllocates();
+
+	static bool Pass_BulkOperations_IndexPastEndIgnored();
+	static bool Pass_BulkOperations_EmptyRangeIgnored();
+	static bool Pass_BulkOperations_EraseIfKeepsOrder();
+#pragma endregion
+
+#pragma region Benchmark - Move-Aware Append
+	static void Benchmark_MoveAwareAppend();
+#pragma endregion
+
+#pragma region Benchmark - Trivially Copyable Growth
+	static void Benchmark_TriviallyCopyableGrowth();
+#pragma endregion
+
+#pragma region Benchmark - Small Arrays
+	static void Benchmark_SmallArrays();
+#pragma endregion
+
+#pragma region Benchmark - Growth Policies
+	static void Benchmark_GrowthPolicies();
+#pragma endregion
 #endif
 };
\ No newline at end of file
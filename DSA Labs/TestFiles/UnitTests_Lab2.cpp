@@ -14,6 +14,8 @@ Notes:			Property of Full Sail University
 /************/
 #include "UnitTests_Lab2.h"
 #include "Memory_Management.h"
+#include <chrono>
+#include <iostream>
 #include <string>
 
 #if LAB_2
@@ -52,6 +54,55 @@ void UnitTests_Lab2::FullBattery() {
 #if LAB2_MOVE_PALINDROMES
 	Battery_MovePalindromes();
 #endif
+#if LAB2_FILL_VALIDATION
+	Battery_FillValidation();
+#endif
+#if LAB2_FILE_VIEW
+	Battery_FileView();
+#endif
+#if LAB2_MOVE_PALINDROMES_PARALLEL
+	Battery_MovePalindromesParallel();
+#endif
+#if LAB2_PALINDROME_KERNELS
+	Battery_PalindromeKernels();
+#endif
+#if LAB2_SEARCH_MODES
+	Battery_SearchModes();
+#endif
+#if LAB2_SORT_BACKENDS
+	Battery_SortBackends();
+#endif
+#if LAB2_TEXT_PARSER
+	Battery_TextParser();
+#endif
+#if LAB2_FILL_BENCHMARK
+	Benchmark_FillFromFile();
+#endif
+#if LAB2_MOVE_PALINDROMES_BENCHMARK
+	Benchmark_MovePalindromes();
+#endif
+#if LAB2_SORT_BENCHMARK
+	Benchmark_SortBackends();
+#endif
+}
+
+// Writes a binary int file with any header to mTempFilename (a new random name)
+//
+// In:	_header				The count to put in the first four bytes
+//		_values				The ints that follow the header
+//		_extraBytes			The number of stray bytes to add after the ints (less than four)
+void UnitTests_Lab2::WriteIntFile(int _header, const std::vector<int>& _values, size_t _extraBytes) {
+	mTempFilename.clear();
+	for (int i = 0; i < 8; ++i)
+		mTempFilename += (char)RandomInt('a', 'z');
+	mTempFilename += ".bin";
+
+	std::ofstream ofl(mTempFilename, std::ios::binary);
+	ofl.write((const char*)&_header, sizeof(int));
+	ofl.write((const char*)_values.data(), _values.size() * sizeof(int));
+
+	const char stray[3] = { 1, 2, 3 };
+	ofl.write(stray, _extraBytes);
 }
 
 #pragma region Test - Palindrome Number
@@ -1210,4 +1261,1231 @@ bool UnitTests_Lab2::Pass_MovePalindromes_CorrectValuesRemovedFromValuesVector()
 #pragma endregion
 #endif
 #pragma endregion
+
+#pragma region Test - Fill Validation
+#if LAB2_FILL_VALIDATION
+void UnitTests_Lab2::Battery_FillValidation() {
+	FailVector failVec;
+	failVec.push_back(Fail_FillValidation_ZeroHeaderAddsValues);
+	failVec.push_back(Fail_FillValidation_NegativeHeaderAddsValues);
+	failVec.push_back(Fail_FillValidation_HeaderPastEndOfFile);
+	failVec.push_back(Fail_FillValidation_PartialIntKept);
+
+	PassVector passVec;
+	passVec.push_back(Pass_FillValidation_ShortFilesAddNothing);
+	passVec.push_back(Pass_FillValidation_TruncatedValuesCorrect);
+	passVec.push_back(Pass_FillValidation_ExistingValuesKept);
+
+	UnitTestBattery("Testing filling vector from malformed files", failVec, passVec);
+}
+
+#pragma region Fail Tests
+FailResult UnitTests_Lab2::Fail_FillValidation_ZeroHeaderAddsValues() {
+	WriteIntFile(0, std::vector<int>(RandomInt(1, 20), 7), 0);
+
+	DSA_Lab2 vec;
+	vec.Fill(mTempFilename.c_str());
+	std::remove(mTempFilename.c_str());
+
+	FailResult result;
+	result.check = vec.mValues.size() != 0;
+	result.msg = "Values were added from a file whose header says it holds 0 ints";
+
+	return result;
+}
+
+FailResult UnitTests_Lab2::Fail_FillValidation_NegativeHeaderAddsValues() {
+	FailResult result;
+	result.check = false;
+	result.msg = "Values were added from a file with a negative header";
+
+	// INT_MIN and -1 both turn into huge counts if the header is used as a size_t
+	int headers[] = { -1, RandomInt(-1000, -2), INT_MIN };
+	for (int header : headers)
+	{
+		WriteIntFile(header, std::vector<int>(10, 7), 0);
+
+		DSA_Lab2 vec;
+		vec.Fill(mTempFilename.c_str());
+		std::remove(mTempFilename.c_str());
+
+		result.check = result.check || vec.mValues.size() != 0;
+	}
+
+	return result;
+}
+
+FailResult UnitTests_Lab2::Fail_FillValidation_HeaderPastEndOfFile() {
+	int randomSize = RandomInt(1, 50);
+	WriteIntFile(randomSize + RandomInt(1, 1000), std::vector<int>(randomSize, 7), 0);
+
+	DSA_Lab2 vec;
+	vec.Fill(mTempFilename.c_str());
+	std::remove(mTempFilename.c_str());
+
+	FailResult result;
+	result.check = vec.mValues.size() != (size_t)randomSize;
+	result.msg = "A header larger than the file did not stop at the ints that are there";
+
+	return result;
+}
+
+FailResult UnitTests_Lab2::Fail_FillValidation_PartialIntKept() {
+	int randomSize = RandomInt(1, 50);
+	WriteIntFile(randomSize + 1, std::vector<int>(randomSize, 7), RandomInt(1, 3));
+
+	DSA_Lab2 vec;
+	vec.Fill(mTempFilename.c_str());
+	std::remove(mTempFilename.c_str());
+
+	FailResult result;
+	result.check = vec.mValues.size() != (size_t)randomSize;
+	result.msg = "An int cut off by the end of the file was added";
+
+	return result;
+}
+#pragma endregion
+
+#pragma region Pass Tests
+bool UnitTests_Lab2::Pass_FillValidation_ShortFilesAddNothing() {
+	bool result = true;
+
+	// No file, an empty file, and a file that ends partway through the header
+	DSA_Lab2 missing;
+	missing.Fill("Files\\this_file_does_not_exist.bin");
+	result = missing.mValues.empty();
+
+	for (size_t bytes = 0; bytes < sizeof(int) && result; ++bytes)
+	{
+		mTempFilename = "short_header.bin";
+		std::ofstream ofl(mTempFilename, std::ios::binary);
+		ofl.write("\x05\x00\x00", bytes);
+		ofl.close();
+
+		DSA_Lab2 vec;
+		vec.Fill(mTempFilename.c_str());
+		std::remove(mTempFilename.c_str());
+
+		result = vec.mValues.empty();
+	}
+
+	return result;
+}
+
+bool UnitTests_Lab2::Pass_FillValidation_TruncatedValuesCorrect() {
+	int randomSize = RandomInt(10, 50);
+	int* randomVals = CreateRandomArray(randomSize);
+	std::vector<int> values(randomVals, randomVals + randomSize);
+	delete[] randomVals;
+
+	WriteIntFile(randomSize * 2, values, 2);
+
+	DSA_Lab2 vec;
+	vec.Fill(mTempFilename.c_str());
+	std::remove(mTempFilename.c_str());
+
+	bool result = vec.mValues == values;
+
+	return result;
+}
+
+bool UnitTests_Lab2::Pass_FillValidation_ExistingValuesKept() {
+	std::vector<int> existing = { 1, 2, 3 };
+	std::vector<int> values = { 4, 5, 6, 7 };
+
+	DSA_Lab2 vec;
+	vec.mValues = existing;
+
+	// A bad file leaves the vector alone, a truncated one adds what it has after the old values
+	WriteIntFile(-4, values, 0);
+	vec.Fill(mTempFilename.c_str());
+	std::remove(mTempFilename.c_str());
+	bool result = vec.mValues == existing;
+
+	WriteIntFile(100, values, 1);
+	vec.Fill(mTempFilename.c_str());
+	std::remove(mTempFilename.c_str());
+
+	existing.insert(existing.end(), values.begin(), values.end());
+	result = result && vec.mValues == existing;
+
+	return result;
+}
+#pragma endregion
+#endif
+#pragma endregion
+
+#pragma region Test - File View
+#if LAB2_FILE_VIEW
+void UnitTests_Lab2::Battery_FileView() {
+
+	// Creating unique filename for test and duplicate file
+	mTempFilename.clear();
+	for (int i = 0; i < 8; ++i)
+		mTempFilename += (char)RandomInt('a', 'z');
+	mTempFilename += ".bin";
+	CreateDuplicateFile("Files\\numbers.bin", mTempFilename.c_str());
+
+	FailVector failVec;
+	failVec.push_back(Fail_FileView_SizeDiffersFromFill);
+	failVec.push_back(Fail_FileView_ContainsDiffersFromFill);
+	failVec.push_back(Fail_FileView_CountDiffersFromFill);
+	failVec.push_back(Fail_FileView_CountPalindromesDiffersFromFill);
+	failVec.push_back(Fail_FileView_MissingFileOpens);
+
+	PassVector passVec;
+	passVec.push_back(Pass_FileView_CloseEmptiesView);
+	passVec.push_back(Pass_FileView_MalformedHeaderMatchesFill);
+	passVec.push_back(Pass_FileView_IteratesEveryInt);
+
+	UnitTestBattery("Testing memory-mapped IntFileView", failVec, passVec);
+
+	// Cleaning up after all tests have been run
+	std::remove(mTempFilename.c_str());
+}
+
+#pragma region Fail Tests
+FailResult UnitTests_Lab2::Fail_FileView_SizeDiffersFromFill() {
+	DSA_Lab2 vec;
+	vec.Fill(mTempFilename.c_str());
+	IntFileView view(mTempFilename.c_str());
+
+	FailResult result;
+	result.check = !view.IsOpen() || view.Size() != vec.mValues.size() ||
+		!std::equal(view.begin(), view.end(), vec.mValues.begin());
+	result.msg = "IntFileView did not show the same ints as Fill";
+
+	return result;
+}
+
+FailResult UnitTests_Lab2::Fail_FileView_ContainsDiffersFromFill() {
+	DSA_Lab2 vec;
+	vec.Fill(mTempFilename.c_str());
+	IntFileView view(mTempFilename.c_str());
+
+	// Values from the file, plus random ones that are most likely missing
+	FailResult result;
+	result.check = vec.mValues.empty();
+	for (int i = 0; i < 100 && !result.check; ++i)
+	{
+		int present = vec.mValues[RandomInt(0, (int)vec.mValues.size() - 1)];
+		int random = RandomInt(INT_MIN, INT_MAX);
+
+		result.check = !view.Contains(present) || view.Contains(random) != vec.Contains(random);
+	}
+	result.msg = "IntFileView::Contains did not agree with DSA_Lab2::Contains";
+
+	return result;
+}
+
+FailResult UnitTests_Lab2::Fail_FileView_CountDiffersFromFill() {
+	DSA_Lab2 vec;
+	vec.Fill(mTempFilename.c_str());
+	IntFileView view(mTempFilename.c_str());
+
+	FailResult result;
+	result.check = vec.mValues.empty();
+	for (int i = 0; i < 20 && !result.check; ++i)
+	{
+		int value = vec.mValues[RandomInt(0, (int)vec.mValues.size() - 1)];
+
+		result.check = view.Count(value) != (size_t)std::count(vec.mValues.begin(), vec.mValues.end(), value);
+	}
+	result.msg = "IntFileView::Count gave the wrong number of matches";
+
+	return result;
+}
+
+FailResult UnitTests_Lab2::Fail_FileView_CountPalindromesDiffersFromFill() {
+	DSA_Lab2 vec;
+	vec.Fill(mTempFilename.c_str());
+	vec.MovePalindromes();
+	IntFileView view(mTempFilename.c_str());
+
+	FailResult result;
+	result.check = view.CountPalindromes() != vec.mPalindromes.size();
+	result.msg = "IntFileView::CountPalindromes did not match MovePalindromes";
+
+	return result;
+}
+
+FailResult UnitTests_Lab2::Fail_FileView_MissingFileOpens() {
+	IntFileView view;
+	bool opened = view.Open("Files\\this_file_does_not_exist.bin");
+
+	FailResult result;
+	result.check = opened || view.IsOpen() || view.Size() != 0 || view.Data() != nullptr;
+	result.msg = "Opening a missing file did not leave an empty, closed view";
+
+	return result;
+}
+#pragma endregion
+
+#pragma region Pass Tests
+bool UnitTests_Lab2::Pass_FileView_CloseEmptiesView() {
+	IntFileView view(mTempFilename.c_str());
+	size_t size = view.Size();
+
+	view.Close();
+	bool result = size != 0 && !view.IsOpen() && view.Size() == 0 && view.begin() == view.end();
+
+	// The same view can map a file again
+	result = result && view.Open(mTempFilename.c_str()) && view.Size() == size;
+
+	return result;
+}
+
+bool UnitTests_Lab2::Pass_FileView_MalformedHeaderMatchesFill() {
+	std::string numbersCopy = mTempFilename;
+	bool result = true;
+
+	// A header past the end of the file, and a negative header
+	int headers[] = { 40, -3 };
+	for (int header : headers)
+	{
+		WriteIntFile(header, std::vector<int>(10, 7), 2);
+
+		DSA_Lab2 vec;
+		vec.Fill(mTempFilename.c_str());
+		{
+			IntFileView view(mTempFilename.c_str());
+			result = result && view.IsOpen() && view.Size() == vec.mValues.size();
+		}
+		std::remove(mTempFilename.c_str());
+	}
+
+	mTempFilename = numbersCopy;
+
+	return result;
+}
+
+bool UnitTests_Lab2::Pass_FileView_IteratesEveryInt() {
+	DSA_Lab2 vec;
+	vec.Fill(mTempFilename.c_str());
+	IntFileView view(mTempFilename.c_str());
+
+	long long viewSum = 0, vecSum = 0;
+	for (int value : view)
+		viewSum += value;
+	for (int value : vec.mValues)
+		vecSum += value;
+
+	bool result = view.Size() != 0 && viewSum == vecSum && view[view.Size() - 1] == vec.mValues.back();
+
+	return result;
+}
+#pragma endregion
+#endif
+#pragma endregion
+
+#pragma region Test - Move Palindromes (Parallel)
+#if LAB2_MOVE_PALINDROMES_PARALLEL
+void UnitTests_Lab2::Battery_MovePalindromesParallel() {
+	FailVector failVec;
+	failVec.push_back(Fail_MovePalindromesParallel_ValuesDiffer);
+	failVec.push_back(Fail_MovePalindromesParallel_PalindromesDiffer);
+	failVec.push_back(Fail_MovePalindromesParallel_ExistingPalindromesLost);
+
+	PassVector passVec;
+	passVec.push_back(Pass_MovePalindromesParallel_EmptyVector);
+	passVec.push_back(Pass_MovePalindromesParallel_AllPalindromes);
+	passVec.push_back(Pass_MovePalindromesParallel_MatchesOnFullRange);
+
+	UnitTestBattery("Testing moving palindromes on multiple threads", failVec, passVec);
+}
+
+#pragma region Fail Tests
+FailResult UnitTests_Lab2::Fail_MovePalindromesParallel_ValuesDiffer() {
+	DSA_Lab2 serial, parallel;
+	serial.Fill("Files\\numbers.bin");
+	parallel.Fill("Files\\numbers.bin");
+
+	serial.MovePalindromes();
+	parallel.MovePalindromesParallel();
+
+	FailResult result;
+	result.check = serial.mValues.empty() || parallel.mValues != serial.mValues;
+	result.msg = "MovePalindromesParallel left different values in mValues than MovePalindromes";
+
+	return result;
+}
+
+FailResult UnitTests_Lab2::Fail_MovePalindromesParallel_PalindromesDiffer() {
+	DSA_Lab2 serial, parallel;
+	serial.Fill("Files\\numbers.bin");
+	parallel.Fill("Files\\numbers.bin");
+
+	serial.MovePalindromes();
+	parallel.MovePalindromesParallel();
+
+	FailResult result;
+	result.check = serial.mPalindromes.empty() || parallel.mPalindromes != serial.mPalindromes;
+	result.msg = "MovePalindromesParallel moved different palindromes, or in a different order, than MovePalindromes";
+
+	return result;
+}
+
+FailResult UnitTests_Lab2::Fail_MovePalindromesParallel_ExistingPalindromesLost() {
+	std::vector<int> existing = { 11, 22, 333 };
+	int values[] = { 1, 12, 121, 45, 4554 };
+
+	DSA_Lab2 vec;
+	vec.mPalindromes = existing;
+	vec.Fill(values, 5);
+	vec.MovePalindromesParallel();
+
+	existing.push_back(1);
+	existing.push_back(121);
+	existing.push_back(4554);
+
+	FailResult result;
+	result.check = vec.mPalindromes != existing;
+	result.msg = "Palindromes from an earlier call were overwritten instead of kept in front";
+
+	return result;
+}
+#pragma endregion
+
+#pragma region Pass Tests
+bool UnitTests_Lab2::Pass_MovePalindromesParallel_EmptyVector() {
+	DSA_Lab2 vec;
+	vec.MovePalindromesParallel();
+
+	bool result = vec.mValues.empty() && vec.mPalindromes.empty();
+
+	return result;
+}
+
+bool UnitTests_Lab2::Pass_MovePalindromesParallel_AllPalindromes() {
+	int values[] = { 0, 7, 44, 505, 6116, 72527, 2147447412 };
+
+	DSA_Lab2 vec;
+	vec.Fill(values, 7);
+	vec.MovePalindromesParallel();
+
+	bool result = vec.mValues.empty() && vec.mPalindromes == std::vector<int>(values, values + 7);
+
+	return result;
+}
+
+bool UnitTests_Lab2::Pass_MovePalindromesParallel_MatchesOnFullRange() {
+	// Random ints from the whole range, negative ones included
+	int randomSize = RandomInt(10000, 50000);
+	int* randomVals = CreateRandomArray(randomSize);
+	for (int i = 0; i < randomSize; i += 3)
+		randomVals[i] = RandomInt(0, 99999);
+
+	DSA_Lab2 serial, parallel;
+	serial.Fill(randomVals, randomSize);
+	parallel.Fill(randomVals, randomSize);
+	delete[] randomVals;
+
+	serial.MovePalindromes();
+	parallel.MovePalindromesParallel();
+
+	bool result = parallel.mValues == serial.mValues && parallel.mPalindromes == serial.mPalindromes;
+
+	return result;
+}
+#pragma endregion
+#endif
+#pragma endregion
+
+#pragma region Test - Palindrome Kernels
+#if LAB2_PALINDROME_KERNELS
+void UnitTests_Lab2::Battery_PalindromeKernels() {
+	FailVector failVec;
+	failVec.push_back(Fail_PalindromeKernels_WrongOnWrapValues);
+	failVec.push_back(Fail_PalindromeKernels_WrongOnUnalignedTails);
+	failVec.push_back(Fail_PalindromeKernels_WritesPastOutput);
+
+	PassVector passVec;
+	passVec.push_back(Pass_PalindromeKernels_MatchOnNumbersFile);
+	passVec.push_back(Pass_PalindromeKernels_OutputIsZeroOrOne);
+	passVec.push_back(Pass_PalindromeKernels_FastestKernelSelected);
+
+	UnitTestBattery("Testing SIMD palindrome kernels", failVec, passVec);
+}
+
+// The longest run tested (covers four AVX2 blocks and every tail)
+static const size_t PalindromeKernelMaxCount = 33;
+
+// Return: Every kernel this CPU can run, other than the scalar one
+static std::vector<PalindromeKernel> SupportedPalindromeKernels() {
+	std::vector<PalindromeKernel> kernels;
+#if SIMD_X86
+	const CpuFeatures& cpu = GetCpuFeatures();
+	if (cpu.sse41)
+		kernels.push_back(ClassifyPalindromesSSE41);
+	if (cpu.avx2)
+		kernels.push_back(ClassifyPalindromesAVX2);
+#endif
+	kernels.push_back(ClassifyPalindromes);
+	return kernels;
+}
+
+// Return: True if a kernel gives the same answer as the scalar kernel for every value
+static bool PalindromeKernelMatchesScalar(PalindromeKernel _kernel, const unsigned int* _values, size_t _count) {
+	std::vector<uint8_t> expected(_count), actual(_count);
+	ClassifyPalindromesScalar(_values, _count, expected.data());
+	_kernel(_values, _count, actual.data());
+
+	return expected == actual;
+}
+
+#pragma region Fail Tests
+FailResult UnitTests_Lab2::Fail_PalindromeKernels_WrongOnWrapValues() {
+	// Values near the top of the 32 bit range, where the reversed number overflows
+	// (4294884924 is the largest palindrome that fits)
+	const unsigned int values[] = {
+		4294967295u, 4294884924u, 4294967294u, 2147483647u, 2147483648u, 2147447412u,
+		1999999999u, 3999999993u, 1000000001u, 4000000004u, 1234554321u, 4294967291u,
+		0u, 1u, 9u, 10u, 11u, 100u, 101u, 12321u, 123456u, 3000000003u, 2000000002u, 1000000000u,
+	};
+	const size_t count = sizeof(values) / sizeof(values[0]);
+
+	FailResult result;
+	result.check = false;
+	for (PalindromeKernel kernel : SupportedPalindromeKernels())
+		result.check = result.check || !PalindromeKernelMatchesScalar(kernel, values, count);
+	result.msg = "A kernel disagreed with the scalar kernel on values that overflow when reversed";
+
+	return result;
+}
+
+FailResult UnitTests_Lab2::Fail_PalindromeKernels_WrongOnUnalignedTails() {
+	// Palindromes and near misses in an uneven pattern, so a lane that is skipped or shifted shows up
+	const unsigned int pool[] = { 7u, 12u, 44u, 45u, 505u, 506u, 6116u, 6161u, 72527u, 72572u, 4294884924u };
+	const size_t poolSize = sizeof(pool) / sizeof(pool[0]);
+
+	std::vector<unsigned int> values(PalindromeKernelMaxCount + 8);
+	for (size_t i = 0; i < values.size(); ++i)
+		values[i] = pool[(i * 7) % poolSize];
+
+	FailResult result;
+	result.check = false;
+	for (PalindromeKernel kernel : SupportedPalindromeKernels())
+		for (size_t offset = 0; offset < 8; ++offset)
+			for (size_t count = 0; count <= PalindromeKernelMaxCount; ++count)
+				result.check = result.check || !PalindromeKernelMatchesScalar(kernel, values.data() + offset, count);
+	result.msg = "A kernel disagreed with the scalar kernel on an unaligned start or a partial block";
+
+	return result;
+}
+
+FailResult UnitTests_Lab2::Fail_PalindromeKernels_WritesPastOutput() {
+	const uint8_t guard = 0xAA;
+	std::vector<unsigned int> values(PalindromeKernelMaxCount, 1u);
+
+	FailResult result;
+	result.check = false;
+	for (PalindromeKernel kernel : SupportedPalindromeKernels())
+	{
+		for (size_t count = 0; count <= PalindromeKernelMaxCount; ++count)
+		{
+			std::vector<uint8_t> out(count + 32, guard);
+			kernel(values.data(), count, out.data());
+
+			for (size_t i = count; i < out.size(); ++i)
+				result.check = result.check || out[i] != guard;
+		}
+	}
+	result.msg = "A kernel wrote past the end of its output";
+
+	return result;
+}
+#pragma endregion
+
+#pragma region Pass Tests
+bool UnitTests_Lab2::Pass_PalindromeKernels_MatchOnNumbersFile() {
+	DSA_Lab2 vec;
+	vec.Fill("Files\\numbers.bin");
+	const unsigned int* values = reinterpret_cast<const unsigned int*>(vec.mValues.data());
+
+	bool result = !vec.mValues.empty();
+	for (PalindromeKernel kernel : SupportedPalindromeKernels())
+		result = result && PalindromeKernelMatchesScalar(kernel, values, vec.mValues.size());
+
+	return result;
+}
+
+bool UnitTests_Lab2::Pass_PalindromeKernels_OutputIsZeroOrOne() {
+	int randomSize = RandomInt(1000, 5000);
+	int* randomVals = CreateRandomArray(randomSize);
+
+	bool result = true;
+	for (PalindromeKernel kernel : SupportedPalindromeKernels())
+	{
+		std::vector<uint8_t> out(randomSize, 0xAA);
+		kernel(reinterpret_cast<const unsigned int*>(randomVals), randomSize, out.data());
+
+		for (int i = 0; i < randomSize && result; ++i)
+			result = out[i] == (uint8_t)IsPalindromeNumber(randomVals[i]);
+	}
+
+	delete[] randomVals;
+
+	return result;
+}
+
+bool UnitTests_Lab2::Pass_PalindromeKernels_FastestKernelSelected() {
+	PalindromeKernel expected = ClassifyPalindromesScalar;
+#if SIMD_X86
+	const CpuFeatures& cpu = GetCpuFeatures();
+	if (cpu.avx2)
+		expected = ClassifyPalindromesAVX2;
+	else if (cpu.sse41)
+		expected = ClassifyPalindromesSSE41;
+#endif
+
+	bool result = SelectPalindromeKernel() == expected;
+
+	return result;
+}
+#pragma endregion
+#endif
+#pragma endregion
+
+#pragma region Test - Search Modes
+#if LAB2_SEARCH_MODES
+void UnitTests_Lab2::Battery_SearchModes() {
+	FailVector failVec;
+	failVec.push_back(Fail_SearchModes_IndexStaleAfterFill);
+	failVec.push_back(Fail_SearchModes_IndexStaleAfterSortClearMove);
+	failVec.push_back(Fail_SearchModes_WrongIndexThreshold);
+	failVec.push_back(Fail_SearchModes_EytzingerIndexWrong);
+	failVec.push_back(Fail_SearchModes_ScanKernelsWrong);
+
+	PassVector passVec;
+	passVec.push_back(Pass_SearchModes_ScanModeDropsIndex);
+	passVec.push_back(Pass_SearchModes_IndexKeptBetweenCalls);
+	passVec.push_back(Pass_SearchModes_IndexedMatchesScan);
+
+	UnitTestBattery("Testing indexed and vectorized Contains", failVec, passVec);
+}
+
+// Return: A DSA_Lab2 in indexed mode holding 0, 2, 4, ... (_count values), with its index built
+static DSA_Lab2 IndexedEvens(size_t _count) {
+	std::vector<int> values(_count);
+	for (size_t i = 0; i < _count; ++i)
+		values[i] = (int)i * 2;
+
+	DSA_Lab2 vec;
+	vec.SetSearchMode(DSA_Lab2::SearchMode::Indexed);
+	vec.Fill(values.data(), values.size());
+	vec.Contains(0);
+
+	return vec;
+}
+
+#pragma region Fail Tests
+FailResult UnitTests_Lab2::Fail_SearchModes_IndexStaleAfterFill() {
+	DSA_Lab2 vec = IndexedEvens(100);
+
+	// Fill from an array replaces the values, Fill from a file adds to them
+	int replacement[100];
+	for (int i = 0; i < 100; ++i)
+		replacement[i] = i * 2 + 1;
+	vec.Fill(replacement, 100);
+	bool afterArray = vec.Contains(1) && !vec.Contains(0);
+
+	int firstFromFile = 0;
+	std::ifstream ifl("Files\\numbers.bin", std::ios::binary);
+	ifl.seekg(sizeof(int));
+	ifl.read((char*)&firstFromFile, sizeof(int));
+	ifl.close();
+	vec.Fill("Files\\numbers.bin");
+	bool afterFile = vec.Contains(firstFromFile) && vec.Contains(1);
+
+	FailResult result;
+	result.check = !afterArray || !afterFile;
+	result.msg = "Contains used an out of date index after Fill";
+
+	return result;
+}
+
+FailResult UnitTests_Lab2::Fail_SearchModes_IndexStaleAfterSortClearMove() {
+	bool correct = true;
+
+	// Sort keeps the same values, so the answers stay the same but the index is rebuilt
+	DSA_Lab2 sorted = IndexedEvens(100);
+	sorted.Sort(false);
+	correct = correct && !sorted.mIndexValid && sorted.Contains(198) && !sorted.Contains(199);
+
+	DSA_Lab2 cleared = IndexedEvens(100);
+	cleared.Clear();
+	correct = correct && !cleared.Contains(0) && !cleared.Contains(100);
+
+	// 0, 2, 4, 6, 8, 22, 44, 66 and 88 are palindromes and leave mValues
+	DSA_Lab2 moved = IndexedEvens(100);
+	moved.MovePalindromes();
+	correct = correct && !moved.Contains(44) && !moved.Contains(8) && moved.Contains(10) && moved.Contains(198);
+
+	FailResult result;
+	result.check = !correct;
+	result.msg = "Contains used an out of date index after Sort, Clear or MovePalindromes";
+
+	return result;
+}
+
+FailResult UnitTests_Lab2::Fail_SearchModes_WrongIndexThreshold() {
+	DSA_Lab2 below = IndexedEvens(DSA_Lab2::mIndexMinSize - 1);
+	DSA_Lab2 at = IndexedEvens(DSA_Lab2::mIndexMinSize);
+	DSA_Lab2 above = IndexedEvens(DSA_Lab2::mIndexMinSize + 1);
+
+	FailResult result;
+	result.check = below.mIndexValid || below.mIndex.Size() != 0 ||
+		!at.mIndexValid || at.mIndex.Size() != DSA_Lab2::mIndexMinSize ||
+		!above.mIndexValid || !below.Contains(2) || !at.Contains(2) || !above.Contains(2);
+	result.msg = "The index was built below mIndexMinSize values, or not built at or above it";
+
+	return result;
+}
+
+FailResult UnitTests_Lab2::Fail_SearchModes_EytzingerIndexWrong() {
+	FailResult result;
+	result.check = false;
+	result.msg = "EytzingerIndex disagreed with a linear search";
+
+	// Every size up to a few full levels, with duplicates, so every tree shape is covered
+	for (int size = 0; size <= 70 && !result.check; ++size)
+	{
+		std::vector<int> values(size);
+		for (int i = 0; i < size; ++i)
+			values[i] = RandomInt(-50, 50) * 3;
+
+		EytzingerIndex index;
+		index.Build(values.data(), values.size());
+
+		for (int probe = -152; probe <= 152 && !result.check; ++probe)
+			result.check = index.Contains(probe) != (std::find(values.begin(), values.end(), probe) != values.end());
+
+		result.check = result.check || index.Contains(INT_MIN) || index.Contains(INT_MAX);
+	}
+
+	return result;
+}
+
+FailResult UnitTests_Lab2::Fail_SearchModes_ScanKernelsWrong() {
+	std::vector<IntScanKernel> kernels;
+#if SIMD_X86
+	const CpuFeatures& cpu = GetCpuFeatures();
+	if (cpu.sse2)
+		kernels.push_back(ScanForIntSSE2);
+	if (cpu.avx2)
+		kernels.push_back(ScanForIntAVX2);
+#endif
+	kernels.push_back(ScanForInt);
+
+	std::vector<int> values(41);
+	for (int i = 0; i < 41; ++i)
+		values[i] = i + 1;
+
+	// The target at every position of every count and start offset, a missing value,
+	// and the value just past the end of the range
+	FailResult result;
+	result.check = false;
+	for (IntScanKernel kernel : kernels)
+		for (size_t offset = 0; offset < 4; ++offset)
+			for (size_t count = 0; count + offset < values.size(); ++count)
+			{
+				const int* first = values.data() + offset;
+				for (size_t i = 0; i < count; ++i)
+					result.check = result.check || !kernel(first, count, first[i]);
+				result.check = result.check || kernel(first, count, -1) || kernel(first, count, first[count]);
+			}
+	result.msg = "A scan kernel missed a value, or found one past the end of the range";
+
+	return result;
+}
+#pragma endregion
+
+#pragma region Pass Tests
+bool UnitTests_Lab2::Pass_SearchModes_ScanModeDropsIndex() {
+	DSA_Lab2 vec = IndexedEvens(100);
+	bool built = vec.mIndexValid && vec.mIndex.Size() == 100;
+
+	vec.SetSearchMode(DSA_Lab2::SearchMode::Scan);
+	bool result = built && !vec.mIndexValid && vec.mIndex.Size() == 0 && vec.Contains(198) && !vec.Contains(199);
+
+	return result;
+}
+
+bool UnitTests_Lab2::Pass_SearchModes_IndexKeptBetweenCalls() {
+	DSA_Lab2 vec = IndexedEvens(100);
+
+	// Queries do not change mValues, so the first index is reused
+	bool result = true;
+	for (int i = 0; i < 200 && result; ++i)
+		result = vec.Contains(i) == (i % 2 == 0) && vec.mIndexValid;
+
+	// Duplicates only go in the index once
+	std::vector<int> twice(vec.mValues);
+	twice.insert(twice.end(), vec.mValues.begin(), vec.mValues.end());
+	vec.Fill(twice.data(), twice.size());
+	result = result && vec.Contains(50) && vec.mIndex.Size() == 100;
+
+	return result;
+}
+
+bool UnitTests_Lab2::Pass_SearchModes_IndexedMatchesScan() {
+	DSA_Lab2 scan, indexed;
+	scan.Fill("Files\\numbers.bin");
+	indexed.Fill("Files\\numbers.bin");
+	indexed.SetSearchMode(DSA_Lab2::SearchMode::Indexed);
+
+	bool result = !scan.mValues.empty();
+	for (int i = 0; i < 1000 && result; ++i)
+	{
+		int present = scan.mValues[RandomInt(0, (int)scan.mValues.size() - 1)];
+		int random = RandomInt(INT_MIN, INT_MAX);
+
+		result = indexed.Contains(present) && indexed.Contains(random) == scan.Contains(random);
+	}
+
+	return result;
+}
+#pragma endregion
+#endif
+#pragma endregion
+
+#pragma region Test - Sort Backends
+#if LAB2_SORT_BACKENDS
+void UnitTests_Lab2::Battery_SortBackends() {
+	FailVector failVec;
+	failVec.push_back(Fail_SortBackends_RadixWrongOnExtremes);
+	failVec.push_back(Fail_SortBackends_RadixWrongOnSharedDigits);
+	failVec.push_back(Fail_SortBackends_ParallelWrong);
+
+	PassVector passVec;
+	passVec.push_back(Pass_SortBackends_TinyInputs);
+	passVec.push_back(Pass_SortBackends_PresortedInputs);
+	passVec.push_back(Pass_SortBackends_NumbersFileMatchesStd);
+
+	UnitTestBattery("Testing radix and parallel sort backends", failVec, passVec);
+}
+
+// Sort a copy of some values with a backend, in both directions, and compare with std::sort
+//
+// In:	_backend			The backend to test
+//		_values				The values to sort
+//
+// Return: True if both directions match std::sort
+bool UnitTests_Lab2::SortMatchesStd(DSA_Lab2::SortBackend _backend, const std::vector<int>& _values) {
+	for (int ascending = 0; ascending < 2; ++ascending)
+	{
+		std::vector<int> expected = _values;
+		if (ascending)
+			std::sort(expected.begin(), expected.end(), std::less<int>());
+		else
+			std::sort(expected.begin(), expected.end(), std::greater<int>());
+
+		DSA_Lab2 vec;
+		vec.Fill(_values.data(), _values.size());
+		vec.Sort(ascending == 1, _backend);
+
+		if (vec.mValues != expected)
+			return false;
+	}
+	return true;
+}
+
+#pragma region Fail Tests
+FailResult UnitTests_Lab2::Fail_SortBackends_RadixWrongOnExtremes() {
+	// The sign bit is the one the key flip has to get right
+	std::vector<int> values = { INT_MAX, INT_MIN, -1, 0, 1, INT_MIN + 1, INT_MAX - 1, -256, 255, 256, -257 };
+	for (int i = 0; i < 200; ++i)
+		values.push_back(RandomInt(INT_MIN, INT_MAX));
+	for (int i = 0; i < 20; ++i)
+		values.push_back(i % 2 ? INT_MIN : INT_MAX);
+
+	FailResult result;
+	result.check = !SortMatchesStd(DSA_Lab2::SortBackend::Radix, values);
+	result.msg = "Radix sort put INT_MIN, INT_MAX or negative values in the wrong place";
+
+	return result;
+}
+
+FailResult UnitTests_Lab2::Fail_SortBackends_RadixWrongOnSharedDigits() {
+	FailResult result;
+	result.check = false;
+	result.msg = "Radix sort was wrong when passes were skipped for digits every value shares";
+
+	// Keep 0 to 4 of the bytes varying, so 4, 3, 2, 1 and 0 passes actually run
+	// (an odd number leaves the result in the scratch buffer)
+	for (int varying = 0; varying <= 4 && !result.check; ++varying)
+	{
+		uint32_t mask = varying == 4 ? 0xFFFFFFFFu : (1u << (varying * 8)) - 1;
+		uint32_t shared = (uint32_t)RandomInt(INT_MIN, INT_MAX) & ~mask;
+
+		std::vector<int> values(RandomInt(50, 300));
+		for (int& value : values)
+			value = (int)(shared | ((uint32_t)RandomInt(INT_MIN, INT_MAX) & mask));
+
+		result.check = !SortMatchesStd(DSA_Lab2::SortBackend::Radix, values);
+	}
+
+	return result;
+}
+
+FailResult UnitTests_Lab2::Fail_SortBackends_ParallelWrong() {
+	int randomSize = RandomInt(10000, 50000);
+	int* randomVals = CreateRandomArray(randomSize);
+	std::vector<int> values(randomVals, randomVals + randomSize);
+	delete[] randomVals;
+	values.push_back(INT_MIN);
+	values.push_back(INT_MAX);
+
+	FailResult result;
+	result.check = !SortMatchesStd(DSA_Lab2::SortBackend::Parallel, values);
+	result.msg = "Parallel sort did not match std::sort";
+
+	return result;
+}
+#pragma endregion
+
+#pragma region Pass Tests
+bool UnitTests_Lab2::Pass_SortBackends_TinyInputs() {
+	bool result = true;
+
+	std::vector<std::vector<int>> inputs = { {}, { 5 }, { 2, 1 }, { INT_MIN, INT_MAX }, { 7, 7, 7 } };
+	for (const std::vector<int>& input : inputs)
+		result = result && SortMatchesStd(DSA_Lab2::SortBackend::Radix, input) &&
+			SortMatchesStd(DSA_Lab2::SortBackend::Parallel, input);
+
+	return result;
+}
+
+bool UnitTests_Lab2::Pass_SortBackends_PresortedInputs() {
+	std::vector<int> ascending(1000), descending(1000);
+	for (int i = 0; i < 1000; ++i)
+	{
+		ascending[i] = i * 4096 - 2000000;
+		descending[i] = -ascending[i];
+	}
+
+	bool result = SortMatchesStd(DSA_Lab2::SortBackend::Radix, ascending) &&
+		SortMatchesStd(DSA_Lab2::SortBackend::Radix, descending) &&
+		SortMatchesStd(DSA_Lab2::SortBackend::Parallel, ascending) &&
+		SortMatchesStd(DSA_Lab2::SortBackend::Parallel, descending);
+
+	return result;
+}
+
+bool UnitTests_Lab2::Pass_SortBackends_NumbersFileMatchesStd() {
+	DSA_Lab2 vec;
+	vec.Fill("Files\\numbers.bin");
+
+	bool result = !vec.mValues.empty() && SortMatchesStd(DSA_Lab2::SortBackend::Radix, vec.mValues) &&
+		SortMatchesStd(DSA_Lab2::SortBackend::Parallel, vec.mValues);
+
+	return result;
+}
+#pragma endregion
+#endif
+#pragma endregion
+
+#pragma region Test - Text Parser
+#if LAB2_TEXT_PARSER
+void UnitTests_Lab2::Battery_TextParser() {
+	FailVector failVec;
+	failVec.push_back(Fail_TextParser_SingleThreadDiffersFromFill);
+	failVec.push_back(Fail_TextParser_MultiThreadDiffersFromFill);
+	failVec.push_back(Fail_TextParser_ConvertedFileDiffersFromFill);
+	failVec.push_back(Fail_TextParser_PlusSignMishandled);
+
+	PassVector passVec;
+	passVec.push_back(Pass_TextParser_FillTextAppends);
+	passVec.push_back(Pass_TextParser_BadTokenStopsParse);
+	passVec.push_back(Pass_TextParser_TokensAcrossBufferBoundary);
+
+	UnitTestBattery("Testing the integer text parser", failVec, passVec);
+}
+
+// Return: A new random filename with the given extension
+static std::string RandomTextFilename(const char* _extension) {
+	std::string filename;
+	for (int i = 0; i < 8; ++i)
+		filename += (char)RandomInt('a', 'z');
+	return filename + _extension;
+}
+
+// Write a string to a file as is
+//
+// In:	_filename			The file to create
+//		_text				What to put in it
+static void WriteTextFile(const std::string& _filename, const std::string& _text) {
+	std::ofstream ofl(_filename, std::ios::binary);
+	ofl.write(_text.data(), _text.size());
+}
+
+#pragma region Fail Tests
+FailResult UnitTests_Lab2::Fail_TextParser_SingleThreadDiffersFromFill() {
+	DSA_Lab2 vec;
+	vec.Fill("Files\\numbers.bin");
+
+	std::vector<int> parsed;
+	bool parsedAll = ParseIntText("Files\\numbers.txt", parsed, 1);
+
+	FailResult result;
+	result.check = !parsedAll || vec.mValues.empty() || parsed != vec.mValues;
+	result.msg = "Parsing numbers.txt on one thread did not give the ints in numbers.bin";
+
+	return result;
+}
+
+FailResult UnitTests_Lab2::Fail_TextParser_MultiThreadDiffersFromFill() {
+	DSA_Lab2 vec;
+	vec.Fill("Files\\numbers.bin");
+
+	FailResult result;
+	result.check = vec.mValues.empty();
+	result.msg = "Parsing numbers.txt on several threads did not give the ints in numbers.bin, in order";
+
+	// 0 uses one thread per core
+	unsigned int threadCounts[] = { 2, 3, 4, 7, 0 };
+	for (unsigned int threads : threadCounts)
+	{
+		std::vector<int> parsed;
+		bool parsedAll = ParseIntText("Files\\numbers.txt", parsed, threads);
+
+		result.check = result.check || !parsedAll || parsed != vec.mValues;
+	}
+
+	return result;
+}
+
+FailResult UnitTests_Lab2::Fail_TextParser_ConvertedFileDiffersFromFill() {
+	std::string filename = RandomTextFilename(".bin");
+	bool converted = ConvertIntTextToBinary("Files\\numbers.txt", filename.c_str(), 4);
+
+	DSA_Lab2 original, roundTrip;
+	original.Fill("Files\\numbers.bin");
+	roundTrip.Fill(filename.c_str());
+	std::remove(filename.c_str());
+
+	FailResult result;
+	result.check = !converted || original.mValues.empty() || roundTrip.mValues != original.mValues;
+	result.msg = "ConvertIntTextToBinary did not write a file that Fill reads back as numbers.bin";
+
+	return result;
+}
+
+FailResult UnitTests_Lab2::Fail_TextParser_PlusSignMishandled() {
+	const char text[] = "+5 +0 -3\n+2147483647";
+	std::vector<int> accepted;
+	bool parsed = ParseIntRange(text, text + sizeof(text) - 1, accepted);
+
+	// ifstream >> int rejects all of these
+	bool rejected = true;
+	const char* bad[] = { "+-5", "++5", "+", "+ 5" };
+	for (const char* token : bad)
+	{
+		std::vector<int> out;
+		rejected = rejected && !ParseIntRange(token, token + std::strlen(token), out) && out.empty();
+	}
+
+	FailResult result;
+	result.check = !parsed || accepted != std::vector<int>({ 5, 0, -3, INT_MAX }) || !rejected;
+	result.msg = "A single leading '+' was not accepted, or '+-', '++' or a lone '+' was";
+
+	return result;
+}
+#pragma endregion
+
+#pragma region Pass Tests
+bool UnitTests_Lab2::Pass_TextParser_FillTextAppends() {
+	DSA_Lab2 vec;
+	vec.mValues = { 1, 2, 3 };
+
+	bool parsed = vec.FillText("Files\\numbers.txt", 2);
+
+	DSA_Lab2 binary;
+	binary.Fill("Files\\numbers.bin");
+
+	bool result = parsed && vec.mValues.size() == binary.mValues.size() + 3 && vec.mValues[2] == 3 &&
+		std::equal(binary.mValues.begin(), binary.mValues.end(), vec.mValues.begin() + 3) &&
+		!vec.FillText("Files\\this_file_does_not_exist.txt");
+
+	return result;
+}
+
+bool UnitTests_Lab2::Pass_TextParser_BadTokenStopsParse() {
+	std::string filename = RandomTextFilename(".txt");
+	bool result = true;
+
+	// The ints before the bad token are kept, on one thread and on several
+	const char* texts[] = { "1\n2\nx\n3\n", "1\n2\n2147483648\n3\n", "1\n2\n3.5\n4\n" };
+	for (const char* text : texts)
+	{
+		WriteTextFile(filename, text);
+
+		for (unsigned int threads = 1; threads <= 4; threads += 3)
+		{
+			std::vector<int> out;
+			bool parsed = ParseIntText(filename.c_str(), out, threads);
+			result = result && !parsed && out.size() >= 2 && out[0] == 1 && out[1] == 2;
+		}
+	}
+	std::remove(filename.c_str());
+
+	return result;
+}
+
+bool UnitTests_Lab2::Pass_TextParser_TokensAcrossBufferBoundary() {
+	// Well over the 1MB streaming buffer, with tokens of every width and CRLF line ends
+	std::vector<int> expected;
+	std::string text;
+	for (int i = 0; i < 200000; ++i)
+	{
+		int value = i % 2 ? -RandomInt(0, INT_MAX) : RandomInt(0, 1 << (i % 31));
+		expected.push_back(value);
+		text += (i % 5 == 0 && value >= 0 ? "+" : "") + std::to_string(value) + (i % 3 ? "\r\n" : " \t");
+	}
+
+	std::string filename = RandomTextFilename(".txt");
+	WriteTextFile(filename, text);
+
+	std::vector<int> single, multi;
+	bool result = text.size() > (1 << 20) && ParseIntText(filename.c_str(), single, 1) &&
+		ParseIntText(filename.c_str(), multi, 4) && single == expected && multi == expected;
+	std::remove(filename.c_str());
+
+	return result;
+}
+#pragma endregion
+#endif
+#pragma endregion
+
+#pragma region Benchmark - Fill From File
+#if LAB2_FILL_BENCHMARK
+// Times Fill, which reads every int in one call, against reading one int at a time
+// on a copy of numbers.bin scaled up to 25 million ints
+void UnitTests_Lab2::Benchmark_FillFromFile() {
+	const int count = 25000000;
+
+	DSA_Lab2 source;
+	source.Fill("Files\\numbers.bin");
+	if (source.mValues.empty())
+	{
+		std::cout << "Files\\numbers.bin did not open correctly\n";
+		return;
+	}
+
+	std::vector<int> values(count);
+	for (int i = 0; i < count; ++i)
+		values[i] = source.mValues[i % source.mValues.size()];
+	WriteIntFile(count, values, 0);
+	values.clear();
+	values.shrink_to_fit();
+
+	std::cout << "Benchmarking reading " << count << " ints from a scaled copy of numbers.bin\n";
+
+	auto start = std::chrono::steady_clock::now();
+	DSA_Lab2 bulk;
+	bulk.Fill(mTempFilename.c_str());
+	auto end = std::chrono::steady_clock::now();
+	std::cout << "  Fill (one read): " << std::chrono::duration<double, std::milli>(end - start).count() << " ms\n";
+
+	start = std::chrono::steady_clock::now();
+	std::vector<int> single;
+	std::ifstream ifl(mTempFilename, std::ios::binary);
+	int size = 0, value = 0;
+	ifl.read((char*)&size, sizeof(int));
+	for (int i = 0; i < size && ifl.read((char*)&value, sizeof(int)); ++i)
+		single.push_back(value);
+	ifl.close();
+	end = std::chrono::steady_clock::now();
+	std::cout << "  One int per read: " << std::chrono::duration<double, std::milli>(end - start).count() << " ms\n";
+
+	if (single != bulk.mValues)
+		std::cout << "  The two reads did not match\n";
+
+	std::remove(mTempFilename.c_str());
+}
+#endif
+#pragma endregion
+
+#pragma region Benchmark - Move Palindromes
+#if LAB2_MOVE_PALINDROMES_BENCHMARK
+// Times MovePalindromes and MovePalindromesParallel on numbers.bin scaled up
+// to 1, 4 and 16 million ints
+//		Both should scale linearly, so the time per million ints should stay flat
+void UnitTests_Lab2::Benchmark_MovePalindromes() {
+	DSA_Lab2 source;
+	source.Fill("Files\\numbers.bin");
+	if (source.mValues.empty())
+	{
+		std::cout << "Files\\numbers.bin did not open correctly\n";
+		return;
+	}
+
+	std::cout << "Benchmarking MovePalindromes on scaled copies of numbers.bin\n";
+
+	for (size_t count = 1000000; count <= 16000000; count *= 4)
+	{
+		std::vector<int> values(count);
+		for (size_t i = 0; i < count; ++i)
+			values[i] = source.mValues[i % source.mValues.size()];
+
+		DSA_Lab2 serial, parallel;
+		serial.mValues = values;
+		parallel.mValues = values;
+
+		auto start = std::chrono::steady_clock::now();
+		serial.MovePalindromes();
+		auto middle = std::chrono::steady_clock::now();
+		parallel.MovePalindromesParallel();
+		auto end = std::chrono::steady_clock::now();
+
+		double serialMs = std::chrono::duration<double, std::milli>(middle - start).count();
+		double parallelMs = std::chrono::duration<double, std::milli>(end - middle).count();
+		double millions = count / 1000000.0;
+
+		std::cout << "  " << count << " ints: MovePalindromes " << serialMs << " ms (" << serialMs / millions
+			<< " ms per million), MovePalindromesParallel " << parallelMs << " ms (" << parallelMs / millions << " ms per million)\n";
+	}
+}
+#endif
+#pragma endregion
+
+#pragma region Benchmark - Sort Backends
+#if LAB2_SORT_BENCHMARK
+// Times every Sort backend on numbers.bin scaled up to 10 and 100 million ints
+//		Each backend sorts its own fresh copy, so they all start from the same order
+void UnitTests_Lab2::Benchmark_SortBackends() {
+	DSA_Lab2 source;
+	source.Fill("Files\\numbers.bin");
+	if (source.mValues.empty())
+	{
+		std::cout << "Files\\numbers.bin did not open correctly\n";
+		return;
+	}
+
+	const DSA_Lab2::SortBackend backends[] = { DSA_Lab2::SortBackend::Std, DSA_Lab2::SortBackend::Radix, DSA_Lab2::SortBackend::Parallel };
+	const char* names[] = { "std::sort", "Radix", "Parallel" };
+
+	std::cout << "Benchmarking Sort backends on scaled copies of numbers.bin\n";
+
+	for (size_t count = 10000000; count <= 100000000; count *= 10)
+	{
+		for (int backend = 0; backend < 3; ++backend)
+		{
+			DSA_Lab2 vec;
+			vec.mValues.resize(count);
+			for (size_t i = 0; i < count; ++i)
+				vec.mValues[i] = source.mValues[i % source.mValues.size()];
+
+			auto start = std::chrono::steady_clock::now();
+			vec.Sort(true, backends[backend]);
+			auto end = std::chrono::steady_clock::now();
+
+			std::cout << "  " << count << " ints, " << names[backend] << ": "
+				<< std::chrono::duration<double, std::milli>(end - start).count() << " ms"
+				<< (std::is_sorted(vec.mValues.begin(), vec.mValues.end()) ? "" : " (NOT SORTED)") << '\n';
+		}
+	}
+}
+#endif
+#pragma endregion
 #endif
\ No newline at end of file
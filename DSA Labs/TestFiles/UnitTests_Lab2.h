@@ -16,6 +16,7 @@ Notes:			Property of Full Sail University
 /************/
 #include "UnitTestHelper.h"
 #include "..\\Lab2.h"
+#include "..\\IntFileView.h"
 
 class UnitTests_Lab2 {
 
@@ -27,6 +28,13 @@ public:
 	// Runs all active unit tests
 	static void FullBattery();
 
+	// Writes a binary int file with any header to mTempFilename (a new random name)
+	//
+	// In:	_header				The count to put in the first four bytes
+	//		_values				The ints that follow the header
+	//		_extraBytes			The number of stray bytes to add after the ints (less than four)
+	static void WriteIntFile(int _header, const std::vector<int>& _values, size_t _extraBytes);
+
 #pragma region Test - Palindrome Number
 	static void Battery_PalindromeNumber();
 
@@ -136,5 +144,115 @@ public:
 	static bool Pass_MovePalindromes_CorrectValuesAddedToPalindromesVector();
 	static bool Pass_MovePalindromes_CorrectValuesRemovedFromValuesVector();
 #pragma endregion
+
+#pragma region Test - Fill Validation
+	static void Battery_FillValidation();
+
+	static FailResult Fail_FillValidation_ZeroHeaderAddsValues();
+	static FailResult Fail_FillValidation_NegativeHeaderAddsValues();
+	static FailResult Fail_FillValidation_HeaderPastEndOfFile();
+	static FailResult Fail_FillValidation_PartialIntKept();
+
+	static bool Pass_FillValidation_ShortFilesAddNothing();
+	static bool Pass_FillValidation_TruncatedValuesCorrect();
+	static bool Pass_FillValidation_ExistingValuesKept();
+#pragma endregion
+
+#pragma region Test - File View
+	static void Battery_FileView();
+
+	static FailResult Fail_FileView_SizeDiffersFromFill();
+	static FailResult Fail_FileView_ContainsDiffersFromFill();
+	static FailResult Fail_FileView_CountDiffersFromFill();
+	static FailResult Fail_FileView_CountPalindromesDiffersFromFill();
+	static FailResult Fail_FileView_MissingFileOpens();
+
+	static bool Pass_FileView_CloseEmptiesView();
+	static bool Pass_FileView_MalformedHeaderMatchesFill();
+	static bool Pass_FileView_IteratesEveryInt();
+#pragma endregion
+
+#pragma region Test - Move Palindromes (Parallel)
+	static void Battery_MovePalindromesParallel();
+
+	static FailResult Fail_MovePalindromesParallel_ValuesDiffer();
+	static FailResult Fail_MovePalindromesParallel_PalindromesDiffer();
+	static FailResult Fail_MovePalindromesParallel_ExistingPalindromesLost();
+
+	static bool Pass_MovePalindromesParallel_EmptyVector();
+	static bool Pass_MovePalindromesParallel_AllPalindromes();
+	static bool Pass_MovePalindromesParallel_MatchesOnFullRange();
+#pragma endregion
+
+#pragma region Test - Palindrome Kernels
+	static void Battery_PalindromeKernels();
+
+	static FailResult Fail_PalindromeKernels_WrongOnWrapValues();
+	static FailResult Fail_PalindromeKernels_WrongOnUnalignedTails();
+	static FailResult Fail_PalindromeKernels_WritesPastOutput();
+
+	static bool Pass_PalindromeKernels_MatchOnNumbersFile();
+	static bool Pass_PalindromeKernels_OutputIsZeroOrOne();
+	static bool Pass_PalindromeKernels_FastestKernelSelected();
+#pragma endregion
+
+#pragma region Test - Search Modes
+	static void Battery_SearchModes();
+
+	static FailResult Fail_SearchModes_IndexStaleAfterFill();
+	static FailResult Fail_SearchModes_IndexStaleAfterSortClearMove();
+	static FailResult Fail_SearchModes_WrongIndexThreshold();
+	static FailResult Fail_SearchModes_EytzingerIndexWrong();
+	static FailResult Fail_SearchModes_ScanKernelsWrong();
+
+	static bool Pass_SearchModes_ScanModeDropsIndex();
+	static bool Pass_SearchModes_IndexKeptBetweenCalls();
+	static bool Pass_SearchModes_IndexedMatchesScan();
+#pragma endregion
+
+#pragma region Test - Sort Backends
+	// Sort a copy of some values with a backend, in both directions, and compare with std::sort
+	//
+	// In:	_backend			The backend to test
+	//		_values				The values to sort
+	//
+	// Return: True if both directions match std::sort
+	static bool SortMatchesStd(DSA_Lab2::SortBackend _backend, const std::vector<int>& _values);
+
+	static void Battery_SortBackends();
+
+	static FailResult Fail_SortBackends_RadixWrongOnExtremes();
+	static FailResult Fail_SortBackends_RadixWrongOnSharedDigits();
+	static FailResult Fail_SortBackends_ParallelWrong();
+
+	static bool Pass_SortBackends_TinyInputs();
+	static bool Pass_SortBackends_PresortedInputs();
+	static bool Pass_SortBackends_NumbersFileMatchesStd();
+#pragma endregion
+
+#pragma region Test - Text Parser
+	static void Battery_TextParser();
+
+	static FailResult Fail_TextParser_SingleThreadDiffersFromFill();
+	static FailResult Fail_TextParser_MultiThreadDiffersFromFill();
+	static FailResult Fail_TextParser_ConvertedFileDiffersFromFill();
+	static FailResult Fail_TextParser_PlusSignMishandled();
+
+	static bool Pass_TextParser_FillTextAppends();
+	static bool Pass_TextParser_BadTokenStopsParse();
+	static bool Pass_TextParser_TokensAcrossBufferBoundary();
+#pragma endregion
+
+#pragma region Benchmark - Fill From File
+	static void Benchmark_FillFromFile();
+#pragma endregion
+
+#pragma region Benchmark - Move Palindromes
+	static void Benchmark_MovePalindromes();
+#pragma endregion
+
+#pragma region Benchmark - Sort Backends
+	static void Benchmark_SortBackends();
+#pragma endregion
 #endif
 };
\ No newline at end of file
@@ -14,6 +14,9 @@ Notes:			Property of Full Sail University
 /************/
 #include "UnitTests_Lab3.h"
 #include "Memory_Management.h"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
 
 #if LAB_3
 void UnitTests_Lab3::FullBattery() {
@@ -92,6 +95,30 @@ void UnitTests_Lab3::FullBattery() {
 #if LAB3_COPY_CTOR
 	Battery_CopyConstructor();
 #endif
+#if LAB3_MOVE_SEMANTICS
+	Battery_MoveSemantics();
+#endif
+#if LAB3_STRESS
+	Battery_Stress();
+#endif
+#if LAB3_UNROLLED
+	Battery_UnrolledDList();
+#endif
+#if LAB3_INTRUSIVE
+	Battery_IntrusiveDList();
+#endif
+#if LAB3_POOL
+	Battery_PoolAllocator();
+#endif
+#if LAB3_SPLICE
+	Battery_SpliceMergeSort();
+#endif
+#if LAB3_POOL_BENCHMARK
+	Benchmark_PoolChurn();
+#endif
+#if LAB3_SPLICE_BENCHMARK
+	Benchmark_SpliceMergeSort();
+#endif
 }
 
 // Protection in case pointers are still set to -1
@@ -5071,4 +5098,1632 @@ bool UnitTests_Lab3::Pass_CopyConstructor_SizeIsTheSame() {
 #pragma endregion
 #endif
 #pragma endregion
+
+#pragma region Test - Move Semantics
+#if LAB3_MOVE_SEMANTICS
+void UnitTests_Lab3::Battery_MoveSemantics() {
+	FailVector failVec;
+	failVec.push_back(Fail_MoveSemantics_MemoryIsAllocated);
+	failVec.push_back(Fail_MoveSemantics_NodesAreNotTransferred);
+	failVec.push_back(Fail_MoveSemantics_ArgumentIsNotEmpty);
+
+	PassVector passVec;
+	passVec.push_back(Pass_MoveSemantics_NoMemoryAllocated);
+	passVec.push_back(Pass_MoveSemantics_NodesAreTransferred);
+	passVec.push_back(Pass_MoveSemantics_ArgumentIsEmpty);
+
+	UnitTestBattery("Testing move constructor and move assignment", failVec, passVec);
+}
+
+#pragma region Fail Tests
+FailResult UnitTests_Lab3::Fail_MoveSemantics_MemoryIsAllocated() {
+	List list1;
+	int numberOfNodes = RandomInt(6, 10);
+	std::vector<Node*> nodes;
+	CreateList(list1, nodes, numberOfNodes);
+	List list3;
+
+	size_t memoryDeltaStart = inUse;
+	List list2 = std::move(list1);
+	list3 = std::move(list2);
+	size_t memoryDeltaEnd = inUse;
+
+	FailResult result;
+	result.check = memoryDeltaEnd != memoryDeltaStart;
+	result.msg = "Memory was allocated while moving";
+
+	return result;
+}
+
+FailResult UnitTests_Lab3::Fail_MoveSemantics_NodesAreNotTransferred() {
+	List list1;
+	int numberOfNodes = RandomInt(6, 10);
+	std::vector<Node*> nodes;
+	CreateList(list1, nodes, numberOfNodes);
+	List list3;
+
+	List list2 = std::move(list1);
+	list3 = std::move(list2);
+
+	FailResult result;
+	result.check = list3.mHead != nodes.front() || list3.mTail != nodes.back() || list3.mSize != numberOfNodes;
+	result.msg = "Nodes were not handed over to the invoking object";
+
+	return result;
+}
+
+FailResult UnitTests_Lab3::Fail_MoveSemantics_ArgumentIsNotEmpty() {
+	List list1;
+	int numberOfNodes = RandomInt(6, 10);
+	std::vector<Node*> nodes;
+	CreateList(list1, nodes, numberOfNodes);
+	List list3;
+
+	List list2 = std::move(list1);
+	list3 = std::move(list2);
+
+	FailResult result;
+	result.check = list1.mHead != nullptr || list1.mTail != nullptr || list1.mSize != 0 ||
+		list2.mHead != nullptr || list2.mTail != nullptr || list2.mSize != 0;
+	result.msg = "Moved-from list still holds the nodes";
+
+	// Preventing crash
+	if (result.check) {
+		list1.mHead = list1.mTail = list2.mHead = list2.mTail = nullptr;
+		list1.mSize = list2.mSize = 0;
+	}
+
+	return result;
+}
+#pragma endregion
+
+#pragma region Pass Tests
+bool UnitTests_Lab3::Pass_MoveSemantics_NoMemoryAllocated() {
+	List list1;
+	int numberOfNodes = RandomInt(6, 10);
+	std::vector<Node*> nodes;
+	CreateList(list1, nodes, numberOfNodes);
+	List list3;
+
+	size_t memoryDeltaStart = inUse;
+	List list2 = std::move(list1);
+	list3 = std::move(list2);
+	size_t memoryDeltaEnd = inUse;
+
+	bool result = memoryDeltaEnd == memoryDeltaStart;
+
+	return result;
+}
+
+bool UnitTests_Lab3::Pass_MoveSemantics_NodesAreTransferred() {
+	List list1;
+	int numberOfNodes = RandomInt(6, 10);
+	std::vector<Node*> nodes;
+	CreateList(list1, nodes, numberOfNodes);
+	List list3;
+
+	List list2 = std::move(list1);
+	list3 = std::move(list2);
+
+	bool result = list3.mHead == nodes.front() && list3.mTail == nodes.back() && list3.mSize == numberOfNodes;
+
+	return result;
+}
+
+bool UnitTests_Lab3::Pass_MoveSemantics_ArgumentIsEmpty() {
+	List list1;
+	int numberOfNodes = RandomInt(6, 10);
+	std::vector<Node*> nodes;
+	CreateList(list1, nodes, numberOfNodes);
+	List list3;
+
+	List list2 = std::move(list1);
+	list3 = std::move(list2);
+
+	bool result = list1.mHead == nullptr && list1.mTail == nullptr && list1.mSize == 0 &&
+		list2.mHead == nullptr && list2.mTail == nullptr && list2.mSize == 0;
+
+	return result;
+}
+#pragma endregion
+#endif
+#pragma endregion
+
+#pragma region Test - Stress
+#if LAB3_STRESS
+// Long enough that one stack frame per node would overflow the stack
+// (kept small enough that two copies of the list fit in a 32-bit build)
+const int stressNodeCount = 1000000;
+
+void UnitTests_Lab3::Battery_Stress() {
+	FailVector failVec;
+	failVec.push_back(Fail_Stress_ClearLeaksNodes);
+	failVec.push_back(Fail_Stress_ClearDoesNotResetList);
+	failVec.push_back(Fail_Stress_CopyIsTruncated);
+	failVec.push_back(Fail_Stress_AssignmentLeaksOldNodes);
+
+	PassVector passVec;
+	passVec.push_back(Pass_Stress_ClearFreesAllMemory);
+	passVec.push_back(Pass_Stress_CopyIsTheSame);
+
+	UnitTestBattery("Testing Clear and copy on a 1 million node list", failVec, passVec);
+}
+
+// Checks that two lists hold the same values in the same order
+static bool StressListsMatch(const UnitTests_Lab3::List& _a, const UnitTests_Lab3::List& _b) {
+	if (_a.mSize != _b.mSize)
+		return false;
+
+	const UnitTests_Lab3::Node* a = _a.mHead;
+	const UnitTests_Lab3::Node* b = _b.mHead;
+	for (; a != nullptr && b != nullptr; a = a->next, b = b->next) {
+		if (a->data != b->data || a == b)
+			return false;
+	}
+	return a == nullptr && b == nullptr;
+}
+
+#pragma region Fail Tests
+FailResult UnitTests_Lab3::Fail_Stress_ClearLeaksNodes() {
+	size_t memoryStart = inUse;
+	List list;
+	for (int i = 0; i < stressNodeCount; ++i)
+		list.AddTail(i);
+	list.Clear();
+
+	FailResult result;
+	result.check = inUse != memoryStart;
+	result.msg = "Clear did not free every node of a large list";
+
+	return result;
+}
+
+FailResult UnitTests_Lab3::Fail_Stress_ClearDoesNotResetList() {
+	List list;
+	for (int i = 0; i < stressNodeCount; ++i)
+		list.AddHead(i);
+	list.Clear();
+
+	FailResult result;
+	result.check = list.mHead != nullptr || list.mTail != nullptr || list.mSize != 0;
+	result.msg = "Clear on a large list did not reset the head, tail and size";
+
+	return result;
+}
+
+FailResult UnitTests_Lab3::Fail_Stress_CopyIsTruncated() {
+	List list;
+	for (int i = 0; i < stressNodeCount; ++i)
+		list.AddTail(i);
+
+	List copy(list);
+
+	FailResult result;
+	result.check = copy.mSize != list.mSize || copy.mTail == nullptr || copy.mTail->data != stressNodeCount - 1 ||
+		copy.mTail == list.mTail;
+	result.msg = "The copy constructor did not copy every node of a large list";
+
+	return result;
+}
+
+FailResult UnitTests_Lab3::Fail_Stress_AssignmentLeaksOldNodes() {
+	List list;
+	List assigned;
+	for (int i = 0; i < stressNodeCount; ++i) {
+		list.AddTail(i);
+		assigned.AddTail(-i);
+	}
+	size_t memoryBoth = inUse;
+
+	assigned = list;
+
+	FailResult result;
+	result.check = inUse != memoryBoth || assigned.mSize != list.mSize;
+	result.msg = "Assigning over a large list did not free its old nodes";
+
+	return result;
+}
+#pragma endregion
+
+#pragma region Pass Tests
+// Refills a large list after Clear, then lets the destructor free it
+bool UnitTests_Lab3::Pass_Stress_ClearFreesAllMemory() {
+	size_t memoryStart = inUse;
+	bool result;
+	{
+		List list;
+		for (int i = 0; i < stressNodeCount; ++i)
+			list.AddTail(i);
+		list.Clear();
+
+		for (int i = 0; i < stressNodeCount; ++i)
+			list.AddHead(i);
+		result = list.mSize == (size_t)stressNodeCount && list.mHead->data == stressNodeCount - 1 && list.mTail->data == 0;
+	}
+
+	return result && inUse == memoryStart;
+}
+
+// Copies a large list with the copy constructor and the assignment operator
+bool UnitTests_Lab3::Pass_Stress_CopyIsTheSame() {
+	List list1;
+	for (int i = 0; i < stressNodeCount; ++i)
+		list1.AddTail(i);
+
+	List list2(list1);
+	bool result = StressListsMatch(list1, list2);
+	list2.Clear();
+
+	List list3;
+	list3.AddHead(-1);
+	list3 = list1;
+
+	return result && StressListsMatch(list1, list3);
+}
+#pragma endregion
+#endif
+#pragma endregion
+
+#pragma region Test - UnrolledDList
+#if LAB3_UNROLLED
+void UnitTests_Lab3::Battery_UnrolledDList() {
+	FailVector failVec;
+	failVec.push_back(Fail_UnrolledDList_AddTailDoesNotFillNodes);
+	failVec.push_back(Fail_UnrolledDList_AddHeadOrderIsWrong);
+	failVec.push_back(Fail_UnrolledDList_InsertDoesNotSplitFullNode);
+	failVec.push_back(Fail_UnrolledDList_EraseDoesNotMergeNodes);
+	failVec.push_back(Fail_UnrolledDList_EraseDoesNotFreeEmptyNode);
+	failVec.push_back(Fail_UnrolledDList_DecrementDoesNotCrossNodes);
+	failVec.push_back(Fail_UnrolledDList_CopySharesNodes);
+	failVec.push_back(Fail_UnrolledDList_RemoveIfLeaksNodes);
+
+	PassVector passVec;
+	passVec.push_back(Pass_UnrolledDList_AddHeadAndAddTailAreCorrect);
+	passVec.push_back(Pass_UnrolledDList_InsertIsCorrect);
+	passVec.push_back(Pass_UnrolledDList_EraseIsCorrect);
+	passVec.push_back(Pass_UnrolledDList_IteratorsAreCorrect);
+	passVec.push_back(Pass_UnrolledDList_CopyIsCorrect);
+	passVec.push_back(Pass_UnrolledDList_RemoveIfIsCorrect);
+
+	UnitTestBattery("Testing UnrolledDList (4 elements per node)", failVec, passVec);
+}
+
+// Checks that a list holds the same values as a vector, walking forward from Begin
+// and back again from the last element
+static bool UnrolledListMatches(const UnitTests_Lab3::UnrolledList& _list, const std::vector<int>& _values) {
+	if (_list.Size() != _values.size())
+		return false;
+	if (_values.empty())
+		return !(_list.Begin() != _list.End());
+
+	UnitTests_Lab3::UnrolledList::Iterator iter = _list.Begin();
+	for (size_t i = 0; i < _values.size(); ++i) {
+		if (!(iter != _list.End()) || *iter != _values[i])
+			return false;
+		if (i + 1 < _values.size())
+			++iter;
+	}
+
+	// iter is on the last element, so one more step reaches End
+	UnitTests_Lab3::UnrolledList::Iterator end = iter;
+	if (++end != _list.End())
+		return false;
+
+	for (size_t i = _values.size(); i-- > 0;) {
+		if (*iter != _values[i])
+			return false;
+		--iter;
+	}
+	return iter.mCurr == nullptr;
+}
+
+// Moves an iterator _index elements on from Begin
+static UnitTests_Lab3::UnrolledList::Iterator UnrolledIteratorAt(const UnitTests_Lab3::UnrolledList& _list, size_t _index) {
+	UnitTests_Lab3::UnrolledList::Iterator iter = _list.Begin();
+	for (size_t i = 0; i < _index; ++i)
+		++iter;
+	return iter;
+}
+
+#pragma region Fail Tests
+FailResult UnitTests_Lab3::Fail_UnrolledDList_AddTailDoesNotFillNodes() {
+	UnrolledList list;
+	for (int i = 0; i < 8; ++i)
+		list.AddTail(i);
+
+	FailResult result;
+	result.check = list.mHead == nullptr || list.mHead->next != list.mTail ||
+		list.mHead->count != 4 || list.mTail->count != 4 || list.mSize != 8;
+	result.msg = "AddTail started a new node before the last one was full";
+
+	return result;
+}
+
+FailResult UnitTests_Lab3::Fail_UnrolledDList_AddHeadOrderIsWrong() {
+	UnrolledList list;
+	for (int i = 0; i < 6; ++i)
+		list.AddHead(i);
+
+	FailResult result;
+	result.check = !UnrolledListMatches(list, { 5, 4, 3, 2, 1, 0 });
+	result.msg = "AddHead did not put each value in front of the ones before it";
+
+	return result;
+}
+
+FailResult UnitTests_Lab3::Fail_UnrolledDList_InsertDoesNotSplitFullNode() {
+	UnrolledList list;
+	for (int i = 0; i < 4; ++i)
+		list.AddTail(i);
+
+	// One full node, so the insert splits it into { 0, 9, 1 } and { 2, 3 }
+	UnrolledList::Iterator iter = UnrolledIteratorAt(list, 1);
+	list.Insert(iter, 9);
+
+	FailResult result;
+	result.check = list.mHead == list.mTail || list.mHead->count != 3 || list.mTail->count != 2 ||
+		iter.mCurr != list.mHead || iter.mIndex != 1 || !UnrolledListMatches(list, { 0, 9, 1, 2, 3 });
+	result.msg = "Inserting into a full node did not split it in half, or left the iterator off the new value";
+
+	return result;
+}
+
+FailResult UnitTests_Lab3::Fail_UnrolledDList_EraseDoesNotMergeNodes() {
+	UnrolledList list;
+	for (int i = 0; i < 6; ++i)
+		list.AddTail(i);
+
+	// { 0, 1, 2, 3 } { 4, 5 } down to { 3 } { 4, 5 }, which fit in one node
+	UnrolledList::Iterator iter = list.Begin();
+	list.Erase(iter);
+	list.Erase(iter);
+	list.Erase(iter);
+
+	FailResult result;
+	result.check = list.mHead != list.mTail || list.mSize != 3 || *iter != 3 ||
+		!UnrolledListMatches(list, { 3, 4, 5 });
+	result.msg = "Erase left a node under half full when it could merge with the next one";
+
+	return result;
+}
+
+FailResult UnitTests_Lab3::Fail_UnrolledDList_EraseDoesNotFreeEmptyNode() {
+	UnrolledList list;
+	for (int i = 0; i < 5; ++i)
+		list.AddTail(i);
+	size_t memoryTwoNodes = inUse;
+
+	UnrolledList::Iterator iter = UnrolledIteratorAt(list, 4);
+	list.Erase(iter);
+
+	FailResult result;
+	result.check = inUse >= memoryTwoNodes || list.mHead != list.mTail || iter.mCurr != nullptr ||
+		!UnrolledListMatches(list, { 0, 1, 2, 3 });
+	result.msg = "Erasing the only value in a node did not free the node, or did not leave the iterator at End";
+
+	return result;
+}
+
+FailResult UnitTests_Lab3::Fail_UnrolledDList_DecrementDoesNotCrossNodes() {
+	UnrolledList list;
+	for (int i = 0; i < 8; ++i)
+		list.AddTail(i);
+
+	UnrolledList::Iterator iter = UnrolledIteratorAt(list, 4);
+	UnrolledList::Iterator old = iter--;
+
+	FailResult result;
+	result.check = old.mCurr != list.mTail || iter.mCurr != list.mHead || iter.mIndex != 3 || *iter != 3;
+	result.msg = "Decrementing from the first value of a node did not step to the last value of the node before";
+
+	return result;
+}
+
+FailResult UnitTests_Lab3::Fail_UnrolledDList_CopySharesNodes() {
+	UnrolledList list;
+	for (int i = 0; i < 6; ++i)
+		list.AddTail(i);
+
+	UnrolledList copy(list);
+	UnrolledList assigned;
+	assigned = list;
+	*list.Begin() = -1;
+
+	FailResult result;
+	result.check = copy.mHead == list.mHead || assigned.mHead == list.mHead ||
+		*copy.Begin() != 0 || *assigned.Begin() != 0;
+	result.msg = "The copy constructor or assignment operator shared nodes with the original";
+
+	// Preventing crash (the shared nodes would be freed twice)
+	if (copy.mHead == list.mHead)
+		copy.mHead = copy.mTail = nullptr;
+	if (assigned.mHead == list.mHead)
+		assigned.mHead = assigned.mTail = nullptr;
+
+	return result;
+}
+
+FailResult UnitTests_Lab3::Fail_UnrolledDList_RemoveIfLeaksNodes() {
+	size_t memoryStart = inUse;
+	UnrolledList list;
+	for (int i = 0; i < 12; ++i)
+		list.AddTail(i);
+
+	size_t removed = list.RemoveIf([](int) { return true; });
+
+	FailResult result;
+	result.check = removed != 12 || inUse != memoryStart || list.mHead != nullptr || list.mTail != nullptr;
+	result.msg = "RemoveIf did not free the nodes it emptied";
+
+	return result;
+}
+#pragma endregion
+
+#pragma region Pass Tests
+// AddHead and AddTail, on empty and non-empty lists, across many nodes
+bool UnitTests_Lab3::Pass_UnrolledDList_AddHeadAndAddTailAreCorrect() {
+	UnrolledList list;
+	std::vector<int> values;
+
+	list.AddHead(0);
+	values.push_back(0);
+	bool result = UnrolledListMatches(list, values);
+
+	UnrolledList tailList;
+	tailList.AddTail(0);
+	result = result && UnrolledListMatches(tailList, values);
+
+	for (int i = 1; i <= 20; ++i) {
+		list.AddTail(i);
+		values.push_back(i);
+		list.AddHead(-i);
+		values.insert(values.begin(), -i);
+	}
+	return result && UnrolledListMatches(list, values);
+}
+
+// Inserts at the head, the tail (End), and into the middle of full nodes (splitting them)
+bool UnitTests_Lab3::Pass_UnrolledDList_InsertIsCorrect() {
+	UnrolledList list;
+	std::vector<int> values;
+
+	UnrolledList::Iterator iter = list.End();
+	list.Insert(iter, 1);
+	values.push_back(1);
+	bool result = *iter == 1 && UnrolledListMatches(list, values);
+
+	for (int i = 2; i <= 200 && result; ++i) {
+		size_t index = (size_t)RandomInt(0, (int)values.size());
+		iter = UnrolledIteratorAt(list, index);
+		list.Insert(iter, i);
+		values.insert(values.begin() + index, i);
+		result = *iter == i && UnrolledListMatches(list, values);
+	}
+	return result;
+}
+
+// Erases the head, the tail and from the middle (merging nodes) until the list is empty
+bool UnitTests_Lab3::Pass_UnrolledDList_EraseIsCorrect() {
+	UnrolledList list;
+	UnrolledList::Iterator iter = list.Begin();
+	list.Erase(iter);
+	bool result = list.Size() == 0 && iter.mCurr == nullptr;
+
+	std::vector<int> values;
+	for (int i = 0; i < 100; ++i) {
+		list.AddTail(i);
+		values.push_back(i);
+	}
+
+	iter = list.Begin();
+	list.Erase(iter);
+	values.erase(values.begin());
+	result = result && *iter == values.front() && UnrolledListMatches(list, values);
+
+	iter = UnrolledIteratorAt(list, values.size() - 1);
+	list.Erase(iter);
+	values.pop_back();
+	result = result && !(iter != list.End()) && UnrolledListMatches(list, values);
+
+	while (!values.empty() && result) {
+		size_t index = (size_t)RandomInt(0, (int)values.size() - 1);
+		iter = UnrolledIteratorAt(list, index);
+		list.Erase(iter);
+		values.erase(values.begin() + index);
+		result = (index < values.size() ? *iter == values[index] : !(iter != list.End())) &&
+			UnrolledListMatches(list, values);
+	}
+	return result;
+}
+
+// Pre-fix and post-fix increment and decrement across node boundaries
+bool UnitTests_Lab3::Pass_UnrolledDList_IteratorsAreCorrect() {
+	UnrolledList list;
+	for (int i = 0; i < 10; ++i)
+		list.AddTail(i);
+
+	UnrolledList::Iterator iter = list.Begin();
+	bool result = true;
+	for (int i = 0; i < 9 && result; ++i) {
+		UnrolledList::Iterator old = iter++;
+		result = *old == i && *iter == i + 1 && *(++old) == i + 1;
+	}
+	for (int i = 9; i > 0 && result; --i) {
+		UnrolledList::Iterator old = iter--;
+		result = *old == i && *iter == i - 1 && *(--old) == i - 1;
+	}
+
+	*iter = 100;
+	return result && *list.Begin() == 100 && (--iter).mCurr == nullptr;
+}
+
+// Copy constructor and assignment operator (including self-assignment) make separate lists
+bool UnitTests_Lab3::Pass_UnrolledDList_CopyIsCorrect() {
+	UnrolledList list;
+	std::vector<int> values;
+	for (int i = 0; i < 30; ++i) {
+		list.AddTail(i);
+		values.push_back(i);
+	}
+
+	UnrolledList copy(list);
+	UnrolledList assigned;
+	assigned.AddTail(-1);
+	assigned = list;
+	UnrolledList& self = assigned;
+	assigned = self;
+
+	bool result = UnrolledListMatches(copy, values) && UnrolledListMatches(assigned, values) &&
+		copy.Begin().mCurr != list.Begin().mCurr && assigned.Begin().mCurr != list.Begin().mCurr;
+
+	copy.AddHead(-1);
+	*assigned.Begin() = -2;
+	return result && UnrolledListMatches(list, values);
+}
+
+// RemoveIf that empties whole nodes, every node, and none, giving back the memory of emptied nodes
+bool UnitTests_Lab3::Pass_UnrolledDList_RemoveIfIsCorrect() {
+	size_t memoryStart = inUse;
+	bool result;
+	{
+		UnrolledList list;
+		std::vector<int> values;
+		for (int i = 0; i < 40; ++i) {
+			list.AddTail(i);
+			if ((i / 4) % 2 == 1)
+				values.push_back(i);
+		}
+
+		// AddTail fills each node, so this empties every other node
+		result = list.RemoveIf([](int _val) { return (_val / 4) % 2 == 0; }) == 20 && UnrolledListMatches(list, values);
+		result = result && list.RemoveIf([](int) { return false; }) == 0 && UnrolledListMatches(list, values);
+
+		size_t memoryOneNode = inUse;
+		values.clear();
+		result = result && list.RemoveIf([](int) { return true; }) == 20 && UnrolledListMatches(list, values) &&
+			inUse < memoryOneNode;
+
+		list.AddTail(5);
+		values.push_back(5);
+		result = result && UnrolledListMatches(list, values);
+	}
+	return result && inUse == memoryStart;
+}
+#pragma endregion
+#endif
+#pragma endregion
+
+#pragma region Test - IntrusiveDList
+#if LAB3_INTRUSIVE
+void UnitTests_Lab3::Battery_IntrusiveDList() {
+	FailVector failVec;
+	failVec.push_back(Fail_IntrusiveDList_AddAllocates);
+	failVec.push_back(Fail_IntrusiveDList_AddTailLinksWrongNeighbours);
+	failVec.push_back(Fail_IntrusiveDList_RemoveOnEmptyIsNotNull);
+	failVec.push_back(Fail_IntrusiveDList_RemoveHeadLeavesHookLinked);
+	failVec.push_back(Fail_IntrusiveDList_InsertAtBeginMissesHead);
+	failVec.push_back(Fail_IntrusiveDList_EraseTailMissesEnd);
+	failVec.push_back(Fail_IntrusiveDList_OtherHookChanged);
+	failVec.push_back(Fail_IntrusiveDList_DestructorLeavesHooksLinked);
+
+	PassVector passVec;
+	passVec.push_back(Pass_IntrusiveDList_AddAndRemoveAreCorrect);
+	passVec.push_back(Pass_IntrusiveDList_InsertIsCorrect);
+	passVec.push_back(Pass_IntrusiveDList_EraseIsCorrect);
+	passVec.push_back(Pass_IntrusiveDList_TwoHooksAreIndependent);
+	passVec.push_back(Pass_IntrusiveDList_ClearResetsHooks);
+
+	UnitTestBattery("Testing IntrusiveDList", failVec, passVec);
+}
+
+// An object that can be in two lists at once
+struct IntrusiveItem {
+	int data = 0;
+	IntrusiveListHook<IntrusiveItem> allHook;
+	IntrusiveListHook<IntrusiveItem> evenHook;
+};
+
+using IntrusiveAllList = IntrusiveDList<IntrusiveItem, &IntrusiveItem::allHook>;
+using IntrusiveEvenList = IntrusiveDList<IntrusiveItem, &IntrusiveItem::evenHook>;
+
+// Checks that a list links exactly these objects in this order, walking forward
+// from Begin and back again from the last object
+template<typename List>
+static bool IntrusiveMatches(const List& _list, const std::vector<IntrusiveItem*>& _objects) {
+	if (_list.Size() != _objects.size())
+		return false;
+	if (_objects.empty())
+		return !(_list.Begin() != _list.End());
+
+	typename List::Iterator iter = _list.Begin();
+	for (size_t i = 0; i < _objects.size(); ++i) {
+		if (&*iter != _objects[i])
+			return false;
+		if (i + 1 < _objects.size())
+			++iter;
+	}
+
+	typename List::Iterator end = iter;
+	if (++end != _list.End())
+		return false;
+
+	for (size_t i = _objects.size(); i-- > 0;) {
+		if (&*iter != _objects[i])
+			return false;
+		--iter;
+	}
+	return !(iter != _list.End());
+}
+
+// Checks that a hook is not linked to anything
+static bool IntrusiveHookIsReset(const IntrusiveListHook<IntrusiveItem>& _hook) {
+	return _hook.next == nullptr && _hook.prev == nullptr;
+}
+
+#pragma region Fail Tests
+FailResult UnitTests_Lab3::Fail_IntrusiveDList_AddAllocates() {
+	IntrusiveItem items[4];
+	size_t memoryStart = inUse;
+
+	IntrusiveAllList list;
+	list.AddHead(items[1]);
+	list.AddHead(items[0]);
+	list.AddTail(items[2]);
+	list.AddTail(items[3]);
+
+	FailResult result;
+	result.check = inUse != memoryStart;
+	result.msg = "AddHead or AddTail allocated memory";
+
+	return result;
+}
+
+FailResult UnitTests_Lab3::Fail_IntrusiveDList_AddTailLinksWrongNeighbours() {
+	IntrusiveItem items[3];
+	IntrusiveAllList list;
+	for (IntrusiveItem& item : items)
+		list.AddTail(item);
+
+	FailResult result;
+	result.check = list.Size() != 3 ||
+		items[0].allHook.prev != nullptr || items[0].allHook.next != &items[1] ||
+		items[1].allHook.prev != &items[0] || items[1].allHook.next != &items[2] ||
+		items[2].allHook.prev != &items[1] || items[2].allHook.next != nullptr;
+	result.msg = "AddTail did not link each object's hook to its neighbours";
+
+	return result;
+}
+
+FailResult UnitTests_Lab3::Fail_IntrusiveDList_RemoveOnEmptyIsNotNull() {
+	IntrusiveAllList list;
+
+	FailResult result;
+	result.check = list.RemoveHead() != nullptr || list.RemoveTail() != nullptr || list.Size() != 0;
+	result.msg = "RemoveHead or RemoveTail on an empty list did not return null";
+
+	return result;
+}
+
+FailResult UnitTests_Lab3::Fail_IntrusiveDList_RemoveHeadLeavesHookLinked() {
+	IntrusiveItem items[2];
+	IntrusiveAllList list;
+	list.AddTail(items[0]);
+	list.AddTail(items[1]);
+
+	IntrusiveItem* removed = list.RemoveHead();
+
+	FailResult result;
+	result.check = removed != &items[0] || !IntrusiveHookIsReset(items[0].allHook) ||
+		items[1].allHook.prev != nullptr || list.Size() != 1;
+	result.msg = "RemoveHead did not reset the removed object's hook, or left the new head pointing back at it";
+
+	return result;
+}
+
+FailResult UnitTests_Lab3::Fail_IntrusiveDList_InsertAtBeginMissesHead() {
+	IntrusiveItem items[2];
+	IntrusiveAllList list;
+	list.AddTail(items[1]);
+
+	IntrusiveAllList::Iterator iter = list.Begin();
+	list.Insert(iter, items[0]);
+
+	FailResult result;
+	result.check = &*iter != &items[0] || &*list.Begin() != &items[0] || items[1].allHook.prev != &items[0];
+	result.msg = "Inserting at Begin did not make the object the new head";
+
+	return result;
+}
+
+FailResult UnitTests_Lab3::Fail_IntrusiveDList_EraseTailMissesEnd() {
+	IntrusiveItem items[3];
+	IntrusiveAllList list;
+	for (IntrusiveItem& item : items)
+		list.AddTail(item);
+
+	IntrusiveAllList::Iterator iter = list.Begin();
+	++iter;
+	++iter;
+	list.Erase(iter);
+
+	FailResult result;
+	result.check = iter != list.End() || items[1].allHook.next != nullptr ||
+		!IntrusiveHookIsReset(items[2].allHook) || list.RemoveTail() != &items[1];
+	result.msg = "Erasing the tail did not leave the iterator at End, or did not make the object before it the tail";
+
+	return result;
+}
+
+FailResult UnitTests_Lab3::Fail_IntrusiveDList_OtherHookChanged() {
+	IntrusiveItem items[3];
+	IntrusiveAllList all;
+	IntrusiveEvenList evens;
+	for (IntrusiveItem& item : items) {
+		all.AddTail(item);
+		evens.AddTail(item);
+	}
+
+	all.RemoveHead();
+	all.RemoveTail();
+
+	FailResult result;
+	result.check = items[0].evenHook.next != &items[1] || items[2].evenHook.prev != &items[1] || evens.Size() != 3;
+	result.msg = "Removing objects from one list changed their hooks for another list";
+
+	return result;
+}
+
+FailResult UnitTests_Lab3::Fail_IntrusiveDList_DestructorLeavesHooksLinked() {
+	IntrusiveItem items[3];
+	{
+		IntrusiveAllList list;
+		for (IntrusiveItem& item : items)
+			list.AddTail(item);
+	}
+
+	FailResult result;
+	result.check = !IntrusiveHookIsReset(items[0].allHook) || !IntrusiveHookIsReset(items[1].allHook) ||
+		!IntrusiveHookIsReset(items[2].allHook);
+	result.msg = "The destructor left the objects' hooks linked";
+
+	return result;
+}
+#pragma endregion
+
+#pragma region Pass Tests
+// AddHead, AddTail, RemoveHead and RemoveTail, without allocating
+bool UnitTests_Lab3::Pass_IntrusiveDList_AddAndRemoveAreCorrect() {
+	IntrusiveItem items[6];
+	for (int i = 0; i < 6; ++i)
+		items[i].data = i;
+
+	size_t memoryStart = inUse;
+	IntrusiveAllList list;
+	bool result = list.RemoveHead() == nullptr && list.RemoveTail() == nullptr;
+
+	list.AddHead(items[2]);
+	list.AddTail(items[3]);
+	list.AddHead(items[1]);
+	list.AddTail(items[4]);
+	list.AddHead(items[0]);
+	list.AddTail(items[5]);
+	result = result && inUse == memoryStart &&
+		IntrusiveMatches(list, { &items[0], &items[1], &items[2], &items[3], &items[4], &items[5] });
+
+	result = result && list.RemoveHead() == &items[0] && list.RemoveTail() == &items[5] &&
+		IntrusiveHookIsReset(items[0].allHook) && IntrusiveHookIsReset(items[5].allHook) &&
+		IntrusiveMatches(list, { &items[1], &items[2], &items[3], &items[4] });
+
+	while (list.RemoveTail() != nullptr);
+	return result && IntrusiveMatches(list, {}) && IntrusiveHookIsReset(items[1].allHook);
+}
+
+// Insert at the head, the middle and End, leaving the iterator on the new object
+bool UnitTests_Lab3::Pass_IntrusiveDList_InsertIsCorrect() {
+	IntrusiveItem items[5];
+	IntrusiveAllList list;
+
+	IntrusiveAllList::Iterator iter = list.End();
+	list.Insert(iter, items[2]);
+	bool result = &*iter == &items[2] && IntrusiveMatches(list, { &items[2] });
+
+	iter = list.Begin();
+	list.Insert(iter, items[0]);
+	result = result && &*iter == &items[0] && IntrusiveMatches(list, { &items[0], &items[2] });
+
+	++iter;
+	list.Insert(iter, items[1]);
+	result = result && &*iter == &items[1] && IntrusiveMatches(list, { &items[0], &items[1], &items[2] });
+
+	iter = list.End();
+	list.Insert(iter, items[4]);
+	list.Insert(iter, items[3]);
+	return result && &*iter == &items[3] &&
+		IntrusiveMatches(list, { &items[0], &items[1], &items[2], &items[3], &items[4] });
+}
+
+// Erase the head, the middle and the tail, leaving the iterator on the next object
+// and the erased object's hook reset
+bool UnitTests_Lab3::Pass_IntrusiveDList_EraseIsCorrect() {
+	IntrusiveItem items[5];
+	IntrusiveAllList list;
+
+	IntrusiveAllList::Iterator iter = list.Begin();
+	list.Erase(iter);
+	bool result = list.Size() == 0 && !(iter != list.End());
+
+	for (IntrusiveItem& item : items)
+		list.AddTail(item);
+
+	iter = list.Begin();
+	list.Erase(iter);
+	result = result && &*iter == &items[1] && IntrusiveHookIsReset(items[0].allHook) &&
+		IntrusiveMatches(list, { &items[1], &items[2], &items[3], &items[4] });
+
+	++iter;
+	list.Erase(iter);
+	result = result && &*iter == &items[3] && IntrusiveHookIsReset(items[2].allHook) &&
+		IntrusiveMatches(list, { &items[1], &items[3], &items[4] });
+
+	++iter;
+	list.Erase(iter);
+	return result && !(iter != list.End()) && IntrusiveHookIsReset(items[4].allHook) &&
+		IntrusiveMatches(list, { &items[1], &items[3] });
+}
+
+// One set of objects in two lists through separate hooks, changed independently
+bool UnitTests_Lab3::Pass_IntrusiveDList_TwoHooksAreIndependent() {
+	IntrusiveItem items[6];
+	IntrusiveAllList all;
+	IntrusiveEvenList evens;
+	for (int i = 0; i < 6; ++i) {
+		items[i].data = i;
+		all.AddTail(items[i]);
+		if (i % 2 == 0)
+			evens.AddHead(items[i]);
+	}
+
+	bool result = IntrusiveMatches(all, { &items[0], &items[1], &items[2], &items[3], &items[4], &items[5] }) &&
+		IntrusiveMatches(evens, { &items[4], &items[2], &items[0] });
+
+	// Taking an object out of one list leaves it in the other
+	IntrusiveAllList::Iterator iter = all.Begin();
+	++iter;
+	++iter;
+	all.Erase(iter);
+	result = result && evens.RemoveTail() == &items[0] &&
+		IntrusiveMatches(all, { &items[0], &items[1], &items[3], &items[4], &items[5] }) &&
+		IntrusiveMatches(evens, { &items[4], &items[2] }) &&
+		IntrusiveHookIsReset(items[2].allHook) && !IntrusiveHookIsReset(items[2].evenHook);
+
+	all.Clear();
+	return result && IntrusiveMatches(evens, { &items[4], &items[2] });
+}
+
+// Clear, the destructor and a move leave every hook reset, so the objects can be linked again
+bool UnitTests_Lab3::Pass_IntrusiveDList_ClearResetsHooks() {
+	IntrusiveItem items[4];
+	IntrusiveAllList list;
+	for (IntrusiveItem& item : items)
+		list.AddTail(item);
+
+	list.Clear();
+	bool result = IntrusiveMatches(list, {});
+	for (IntrusiveItem& item : items)
+		result = result && IntrusiveHookIsReset(item.allHook);
+
+	{
+		IntrusiveAllList scoped;
+		for (IntrusiveItem& item : items)
+			scoped.AddHead(item);
+
+		IntrusiveAllList moved(std::move(scoped));
+		result = result && IntrusiveMatches(scoped, {}) &&
+			IntrusiveMatches(moved, { &items[3], &items[2], &items[1], &items[0] });
+	}
+	for (IntrusiveItem& item : items)
+		result = result && IntrusiveHookIsReset(item.allHook);
+
+	list.AddTail(items[1]);
+	list.AddTail(items[0]);
+	return result && IntrusiveMatches(list, { &items[1], &items[0] });
+}
+#pragma endregion
+#endif
+#pragma endregion
+
+#pragma region Test - Pool Allocator
+#if LAB3_POOL
+void UnitTests_Lab3::Battery_PoolAllocator() {
+	FailVector failVec;
+	failVec.push_back(Fail_PoolAllocator_NodesComeFromTheHeap);
+	failVec.push_back(Fail_PoolAllocator_ClearLeaksNodes);
+	failVec.push_back(Fail_PoolAllocator_DestructorLeaksNodes);
+	failVec.push_back(Fail_PoolAllocator_CopyAssignKeepsOldPool);
+	failVec.push_back(Fail_PoolAllocator_MoveAssignCopiesNodes);
+	failVec.push_back(Fail_PoolAllocator_SwapKeepsOldPools);
+
+	PassVector passVec;
+	passVec.push_back(Pass_PoolAllocator_ErasedNodeIsReused);
+	passVec.push_back(Pass_PoolAllocator_ChurnKeepsValues);
+	passVec.push_back(Pass_PoolAllocator_CopyIsIndependent);
+	passVec.push_back(Pass_PoolAllocator_AllMemoryIsReturned);
+
+	UnitTestBattery("Testing DList with a PoolAllocator", failVec, passVec);
+}
+
+// Checks that a list holds exactly these values, with every prev link and the tail right
+static bool PoolListMatches(const UnitTests_Lab3::PoolList& _list, const std::vector<int>& _values) {
+	if (_list.mSize != _values.size())
+		return false;
+
+	const UnitTests_Lab3::PoolNode* prev = nullptr;
+	const UnitTests_Lab3::PoolNode* curr = _list.mHead;
+	for (int value : _values) {
+		if (curr == nullptr || curr->data != value || curr->prev != prev)
+			return false;
+		prev = curr;
+		curr = curr->next;
+	}
+	return curr == nullptr && _list.mTail == prev;
+}
+
+#pragma region Fail Tests
+FailResult UnitTests_Lab3::Fail_PoolAllocator_NodesComeFromTheHeap() {
+	size_t memoryStart = inUse;
+	NodePool pool(16);
+	PoolList list(pool);
+
+	// The first node allocates a whole slab, the next fifteen fit in it
+	list.AddTail(0);
+	size_t memoryOneSlab = inUse;
+	for (int i = 1; i < 16; ++i)
+		list.AddTail(i);
+
+	FailResult result;
+	result.check = memoryOneSlab == memoryStart || inUse != memoryOneSlab;
+	result.msg = "Nodes were allocated from the heap instead of the pool";
+
+	return result;
+}
+
+FailResult UnitTests_Lab3::Fail_PoolAllocator_ClearLeaksNodes() {
+	NodePool pool(8);
+	PoolList list(pool);
+	for (int i = 0; i < 8; ++i)
+		list.AddTail(i);
+	size_t memoryFull = inUse;
+
+	// If Clear kept the nodes, refilling the list would need a second slab
+	list.Clear();
+	for (int i = 0; i < 8; ++i)
+		list.AddHead(i);
+
+	FailResult result;
+	result.check = inUse != memoryFull;
+	result.msg = "Clear did not give its nodes back to the pool";
+
+	return result;
+}
+
+FailResult UnitTests_Lab3::Fail_PoolAllocator_DestructorLeaksNodes() {
+	NodePool pool(8);
+	size_t memoryFull = 0;
+	{
+		PoolList list(pool);
+		for (int i = 0; i < 8; ++i)
+			list.AddTail(i);
+		memoryFull = inUse;
+	}
+
+	PoolList list(pool);
+	for (int i = 0; i < 8; ++i)
+		list.AddTail(i);
+
+	FailResult result;
+	result.check = inUse != memoryFull;
+	result.msg = "The destructor did not give its nodes back to the pool";
+
+	return result;
+}
+
+FailResult UnitTests_Lab3::Fail_PoolAllocator_CopyAssignKeepsOldPool() {
+	NodePool poolA;
+	NodePool poolB;
+	PoolList listA(poolA);
+	PoolList listB(poolB);
+	for (int i = 0; i < 3; ++i)
+		listA.AddTail(i);
+	listB.AddTail(-1);
+
+	listB = listA;
+
+	FailResult result;
+	result.check = listB.mAllocator != PoolAllocator<int>(poolA) || !PoolListMatches(listB, { 0, 1, 2 });
+	result.msg = "Copy assignment did not take the source list's pool";
+
+	return result;
+}
+
+FailResult UnitTests_Lab3::Fail_PoolAllocator_MoveAssignCopiesNodes() {
+	NodePool poolA;
+	NodePool poolB;
+	PoolList listA(poolA);
+	PoolList listB(poolB);
+	for (int i = 0; i < 3; ++i)
+		listA.AddTail(i);
+	listB.AddTail(-1);
+	const PoolNode* head = listA.mHead;
+
+	// Different pools, so the nodes can only be taken if the pool goes with them
+	listB = std::move(listA);
+
+	FailResult result;
+	result.check = listB.mAllocator != PoolAllocator<int>(poolA) || listB.mHead != head || listA.mSize != 0;
+	result.msg = "Move assignment copied the nodes instead of taking them along with their pool";
+
+	return result;
+}
+
+FailResult UnitTests_Lab3::Fail_PoolAllocator_SwapKeepsOldPools() {
+	NodePool poolA;
+	NodePool poolB;
+	PoolList listA(poolA);
+	PoolList listB(poolB);
+	listA.AddTail(1);
+	listB.AddTail(2);
+	listB.AddTail(3);
+
+	listA.Swap(listB);
+
+	FailResult result;
+	result.check = listA.mAllocator != PoolAllocator<int>(poolB) || listB.mAllocator != PoolAllocator<int>(poolA);
+	result.msg = "Swap did not exchange the lists' pools";
+
+	// Preventing crash (nodes going back to a pool they did not come from)
+	if (result.check) {
+		listA.mAllocator = PoolAllocator<int>(poolB);
+		listB.mAllocator = PoolAllocator<int>(poolA);
+	}
+
+	return result;
+}
+#pragma endregion
+
+#pragma region Pass Tests
+bool UnitTests_Lab3::Pass_PoolAllocator_ErasedNodeIsReused() {
+	NodePool pool;
+	PoolList list(pool);
+	for (int i = 0; i < 5; ++i)
+		list.AddTail(i);
+
+	PoolList::Iterator iter = list.Begin();
+	++iter;
+	++iter;
+	const PoolNode* erased = iter.mCurr;
+	list.Erase(iter);
+	list.AddTail(9);
+
+	return list.mTail == erased && PoolListMatches(list, { 0, 1, 3, 4, 9 });
+}
+
+bool UnitTests_Lab3::Pass_PoolAllocator_ChurnKeepsValues() {
+	NodePool pool(8);
+	PoolList list(pool);
+	std::vector<int> values;
+	values.reserve(8);
+
+	list.AddTail(0);
+	values.push_back(0);
+	size_t memoryOneSlab = inUse;
+
+	// Never more than eight nodes at once, so one slab serves the whole run
+	for (int i = 1; i < 1000; ++i) {
+		list.AddTail(i);
+		values.push_back(i);
+		if (values.size() == 8) {
+			PoolList::Iterator iter = list.Begin();
+			list.Erase(iter);
+			list.Erase(iter);
+			values.erase(values.begin(), values.begin() + 2);
+		}
+	}
+
+	return inUse == memoryOneSlab && PoolListMatches(list, values);
+}
+
+bool UnitTests_Lab3::Pass_PoolAllocator_CopyIsIndependent() {
+	NodePool pool;
+	PoolList list(pool);
+	for (int i = 0; i < 4; ++i)
+		list.AddTail(i);
+
+	PoolList copy(list);
+	bool result = copy.mAllocator == list.mAllocator && copy.mHead != list.mHead &&
+		PoolListMatches(copy, { 0, 1, 2, 3 });
+
+	list.Clear();
+	list.AddTail(7);
+	return result && PoolListMatches(copy, { 0, 1, 2, 3 }) && PoolListMatches(list, { 7 });
+}
+
+bool UnitTests_Lab3::Pass_PoolAllocator_AllMemoryIsReturned() {
+	size_t memoryStart = inUse;
+	{
+		NodePool poolA;
+		NodePool poolB;
+		PoolList listA(poolA);
+		PoolList listB(poolB);
+		for (int i = 0; i < 100; ++i)
+			listA.AddTail(i);
+
+		PoolList copy(listA);
+		listB = copy;
+		listB.AddHead(-1);
+		PoolList moved(std::move(copy));
+		listA.Swap(listB);
+		listA.Clear();
+	}
+
+	return inUse == memoryStart;
+}
+#pragma endregion
+#endif
+#pragma endregion
+
+#pragma region Test - Splice Merge Sort
+#if LAB3_SPLICE
+void UnitTests_Lab3::Battery_SpliceMergeSort() {
+	FailVector failVec;
+	failVec.push_back(Fail_SpliceMergeSort_WholeListSizesAreWrong);
+	failVec.push_back(Fail_SpliceMergeSort_RangeAcrossListsSizesAreWrong);
+	failVec.push_back(Fail_SpliceMergeSort_NodeAcrossListsSizesAreWrong);
+	failVec.push_back(Fail_SpliceMergeSort_LinksAreBroken);
+	failVec.push_back(Fail_SpliceMergeSort_NoOpChangesList);
+	failVec.push_back(Fail_SpliceMergeSort_MergeIsNotStable);
+	failVec.push_back(Fail_SpliceMergeSort_SortIsNotStable);
+	failVec.push_back(Fail_SpliceMergeSort_NodesAreAllocatedOrReplaced);
+
+	PassVector passVec;
+	passVec.push_back(Pass_SpliceMergeSort_RangeWithinListMovesToEnd);
+	passVec.push_back(Pass_SpliceMergeSort_SpliceIntoEmptyList);
+	passVec.push_back(Pass_SpliceMergeSort_MergeWithEmptyLists);
+	passVec.push_back(Pass_SpliceMergeSort_SortMatchesBucketedOrder);
+
+	UnitTestBattery("Testing Splice, Merge and Sort", failVec, passVec);
+}
+
+// Checks that a list holds exactly these values, with every prev link, mHead and mTail right
+static bool SpliceListMatches(const UnitTests_Lab3::List& _list, const std::vector<int>& _values) {
+	if (_list.mSize != _values.size())
+		return false;
+
+	const UnitTests_Lab3::Node* prev = nullptr;
+	const UnitTests_Lab3::Node* curr = _list.mHead;
+	for (int value : _values) {
+		if (curr == nullptr || curr->data != value || curr->prev != prev)
+			return false;
+		prev = curr;
+		curr = curr->next;
+	}
+	return curr == nullptr && _list.mTail == prev;
+}
+
+// Fills a list with values, in order, at the tail
+static void SpliceFillList(UnitTests_Lab3::List& _list, const std::vector<int>& _values) {
+	for (int value : _values)
+		_list.AddTail(value);
+}
+
+// Moves an iterator forward a number of nodes
+static UnitTests_Lab3::Iterator SpliceIteratorAt(const UnitTests_Lab3::List& _list, size_t _index) {
+	UnitTests_Lab3::Iterator iter = _list.Begin();
+	for (size_t i = 0; i < _index; ++i)
+		++iter;
+	return iter;
+}
+
+// Orders values by their tens digit only, so values in the same ten are equal keys
+static bool SpliceTensLess(int _a, int _b) {
+	return _a / 10 < _b / 10;
+}
+
+#pragma region Fail Tests
+FailResult UnitTests_Lab3::Fail_SpliceMergeSort_WholeListSizesAreWrong() {
+	List listA;
+	List listB;
+	SpliceFillList(listA, { 0, 1, 2 });
+	SpliceFillList(listB, { 7, 8, 9 });
+
+	listA.Splice(SpliceIteratorAt(listA, 1), listB);
+
+	FailResult result;
+	result.check = listA.mSize != 6 || listB.mSize != 0 || listB.mHead != nullptr || listB.mTail != nullptr;
+	result.msg = "Splicing a whole list did not move its size, or left the source list pointing at its old nodes";
+
+	// Preventing crash (both lists would delete the same nodes)
+	if (listB.mHead != nullptr) {
+		listB.mHead = nullptr;
+		listB.mTail = nullptr;
+	}
+
+	return result;
+}
+
+FailResult UnitTests_Lab3::Fail_SpliceMergeSort_RangeAcrossListsSizesAreWrong() {
+	List listA;
+	List listB;
+	SpliceFillList(listA, { 0, 1 });
+	SpliceFillList(listB, { 5, 6, 7, 8 });
+
+	listA.Splice(listA.End(), listB, SpliceIteratorAt(listB, 1), SpliceIteratorAt(listB, 3));
+
+	FailResult result;
+	result.check = listA.mSize != 4 || listB.mSize != 2;
+	result.msg = "Splicing a range between lists did not move the size of the range from one list to the other";
+
+	return result;
+}
+
+FailResult UnitTests_Lab3::Fail_SpliceMergeSort_NodeAcrossListsSizesAreWrong() {
+	List listA;
+	List listB;
+	SpliceFillList(listA, { 0, 1 });
+	SpliceFillList(listB, { 5, 6, 7 });
+
+	listA.Splice(listA.Begin(), listB, SpliceIteratorAt(listB, 2));
+
+	FailResult result;
+	result.check = listA.mSize != 3 || listB.mSize != 2;
+	result.msg = "Splicing one node between lists did not move one from one size to the other";
+
+	return result;
+}
+
+FailResult UnitTests_Lab3::Fail_SpliceMergeSort_LinksAreBroken() {
+	List list;
+	SpliceFillList(list, { 0, 1, 2, 3, 4 });
+
+	// Tail to head, then head to tail, then a range ending at the tail to the head
+	list.Splice(list.Begin(), list, SpliceIteratorAt(list, 4));
+	bool linked = SpliceListMatches(list, { 4, 0, 1, 2, 3 });
+	list.Splice(list.End(), list, list.Begin());
+	linked = linked && SpliceListMatches(list, { 0, 1, 2, 3, 4 });
+	list.Splice(list.Begin(), list, SpliceIteratorAt(list, 3), list.End());
+	linked = linked && SpliceListMatches(list, { 3, 4, 0, 1, 2 });
+
+	FailResult result;
+	result.check = !linked;
+	result.msg = "Splice left a wrong mHead, mTail or prev link when moving nodes to or from the ends";
+
+	return result;
+}
+
+FailResult UnitTests_Lab3::Fail_SpliceMergeSort_NoOpChangesList() {
+	List listA;
+	List listB;
+	SpliceFillList(listA, { 0, 1, 2 });
+	SpliceFillList(listB, { 5, 6 });
+
+	Iterator middle = SpliceIteratorAt(listA, 1);
+	listA.Splice(middle, listA, middle);
+	listA.Splice(listA.Begin(), listB, SpliceIteratorAt(listB, 1), SpliceIteratorAt(listB, 1));
+	listA.Splice(listA.End(), listB, listB.End(), listB.End());
+
+	FailResult result;
+	result.check = !SpliceListMatches(listA, { 0, 1, 2 }) || !SpliceListMatches(listB, { 5, 6 });
+	result.msg = "Splicing a node in front of itself, or an empty range, changed a list";
+
+	// Preventing crash (the links may now loop, so the nodes are leaked rather than deleted)
+	if (result.check) {
+		listA.mHead = listA.mTail = nullptr;
+		listB.mHead = listB.mTail = nullptr;
+	}
+
+	return result;
+}
+
+FailResult UnitTests_Lab3::Fail_SpliceMergeSort_MergeIsNotStable() {
+	List listA;
+	List listB;
+	SpliceFillList(listA, { 12, 10, 25, 41 });
+	SpliceFillList(listB, { 11, 23, 20, 32, 45 });
+
+	listA.Merge(listB, SpliceTensLess);
+
+	FailResult result;
+	result.check = !SpliceListMatches(listA, { 12, 10, 11, 25, 23, 20, 32, 41, 45 }) || listB.mSize != 0;
+	result.msg = "Merge did not keep equal keys in order, with this list's first";
+
+	return result;
+}
+
+FailResult UnitTests_Lab3::Fail_SpliceMergeSort_SortIsNotStable() {
+	List list;
+	SpliceFillList(list, { 31, 12, 35, 10, 33, 14, 2, 17 });
+
+	list.Sort(SpliceTensLess);
+
+	FailResult result;
+	result.check = !SpliceListMatches(list, { 2, 12, 10, 14, 17, 31, 35, 33 });
+	result.msg = "Sort did not keep equal keys in their original order";
+
+	return result;
+}
+
+FailResult UnitTests_Lab3::Fail_SpliceMergeSort_NodesAreAllocatedOrReplaced() {
+	List listA;
+	List listB;
+	SpliceFillList(listA, { 4, 8, 2, 6 });
+	SpliceFillList(listB, { 1, 5, 3, 7 });
+
+	std::vector<const Node*> nodes;
+	for (const Node* curr = listA.mHead; curr != nullptr; curr = curr->next)
+		nodes.push_back(curr);
+	for (const Node* curr = listB.mHead; curr != nullptr; curr = curr->next)
+		nodes.push_back(curr);
+	size_t memoryStart = inUse;
+
+	listA.Splice(SpliceIteratorAt(listA, 2), listB, SpliceIteratorAt(listB, 1), SpliceIteratorAt(listB, 3));
+	listA.Splice(listA.Begin(), listB, listB.Begin());
+	listA.Sort();
+	listB.Sort();
+	listA.Merge(listB);
+
+	// Every value is still in the node it started in
+	bool sameNodes = listA.mSize == nodes.size() && inUse == memoryStart;
+	for (const Node* node : nodes) {
+		const Node* curr = listA.mHead;
+		while (curr != nullptr && curr != node)
+			curr = curr->next;
+		sameNodes = sameNodes && curr != nullptr;
+	}
+
+	FailResult result;
+	result.check = !sameNodes || !SpliceListMatches(listA, { 1, 2, 3, 4, 5, 6, 7, 8 });
+	result.msg = "Splice, Merge or Sort allocated, freed or replaced nodes instead of relinking them";
+
+	return result;
+}
+#pragma endregion
+
+#pragma region Pass Tests
+bool UnitTests_Lab3::Pass_SpliceMergeSort_RangeWithinListMovesToEnd() {
+	List list;
+	SpliceFillList(list, { 0, 1, 2, 3, 4, 5 });
+
+	list.Splice(list.End(), list, SpliceIteratorAt(list, 1), SpliceIteratorAt(list, 3));
+	bool result = SpliceListMatches(list, { 0, 3, 4, 5, 1, 2 });
+
+	list.Splice(SpliceIteratorAt(list, 1), list, SpliceIteratorAt(list, 4), list.End());
+	return result && SpliceListMatches(list, { 0, 1, 2, 3, 4, 5 });
+}
+
+bool UnitTests_Lab3::Pass_SpliceMergeSort_SpliceIntoEmptyList() {
+	List listA;
+	List listB;
+	SpliceFillList(listB, { 3, 4, 5 });
+
+	listA.Splice(listA.End(), listB);
+	bool result = SpliceListMatches(listA, { 3, 4, 5 }) && SpliceListMatches(listB, {});
+
+	listB.Splice(listB.End(), listA, SpliceIteratorAt(listA, 1));
+	listB.Splice(listB.Begin(), listA, listA.Begin(), listA.End());
+	return result && SpliceListMatches(listA, {}) && SpliceListMatches(listB, { 3, 5, 4 });
+}
+
+bool UnitTests_Lab3::Pass_SpliceMergeSort_MergeWithEmptyLists() {
+	List listA;
+	List listB;
+	SpliceFillList(listB, { 1, 2, 3 });
+
+	listB.Merge(listA);
+	bool result = SpliceListMatches(listB, { 1, 2, 3 });
+
+	listA.Merge(listB);
+	result = result && SpliceListMatches(listA, { 1, 2, 3 }) && SpliceListMatches(listB, {});
+
+	listA.Merge(listA);
+	return result && SpliceListMatches(listA, { 1, 2, 3 });
+}
+
+bool UnitTests_Lab3::Pass_SpliceMergeSort_SortMatchesBucketedOrder() {
+	std::vector<int> values(1000);
+	for (int& value : values)
+		value = RandomInt(0, 999);
+
+	// A stable order by tens, built by collecting each ten in its original order
+	// (std::stable_sort's buffer comes from a nothrow new the memory tracking does not see)
+	std::vector<int> sorted;
+	for (int ten = 0; ten < 100; ++ten) {
+		for (int value : values) {
+			if (value / 10 == ten)
+				sorted.push_back(value);
+		}
+	}
+
+	List list;
+	SpliceFillList(list, values);
+	list.Sort(SpliceTensLess);
+
+	return SpliceListMatches(list, sorted);
+}
+#pragma endregion
+#endif
+#pragma endregion
+
+#pragma region Benchmark - Pool Churn
+#if LAB3_POOL_BENCHMARK
+// Keeps a list at a fixed length while adding at the tail and erasing at the head
+//
+// Return: The time taken, in milliseconds
+template<typename ListType>
+static double PoolChurnMs(ListType& _list, int _length, int _rounds) {
+	for (int i = 0; i < _length; ++i)
+		_list.AddTail(i);
+
+	auto start = std::chrono::steady_clock::now();
+	for (int i = 0; i < _rounds; ++i) {
+		_list.AddTail(i);
+		typename ListType::Iterator iter = _list.Begin();
+		_list.Erase(iter);
+	}
+	auto end = std::chrono::steady_clock::now();
+
+	return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+// Times push/erase churn on a list whose nodes come from the heap and one whose nodes come from a NodePool
+void UnitTests_Lab3::Benchmark_PoolChurn() {
+	const int rounds = 10000000;
+
+	std::cout << "Benchmarking " << rounds << " AddTail/Erase pairs\n";
+
+	for (int length = 16; length <= 65536; length *= 64) {
+		List heapList;
+		double heapMs = PoolChurnMs(heapList, length, rounds);
+
+		NodePool pool;
+		PoolList poolList(pool);
+		double poolMs = PoolChurnMs(poolList, length, rounds);
+
+		std::cout << "  " << length << " nodes, HeapAllocator: " << heapMs << " ms\n";
+		std::cout << "  " << length << " nodes, PoolAllocator: " << poolMs << " ms\n";
+	}
+}
+#endif
+#pragma endregion
+
+#pragma region Benchmark - Splice Merge Sort
+#if LAB3_SPLICE_BENCHMARK
+// Times Splice, Merge and Sort against doing the same work by copying values
+//		The copies go through AddTail/Clear, or through a std::vector and back
+void UnitTests_Lab3::Benchmark_SpliceMergeSort() {
+	const int count = 1000000;
+
+	std::cout << "Benchmarking Splice, Merge and Sort on " << count << " node lists\n";
+
+	// Moving the back half of one list onto another
+	{
+		List source;
+		List target;
+		for (int i = 0; i < count; ++i)
+			source.AddTail(i);
+
+		auto start = std::chrono::steady_clock::now();
+		Iterator half = source.Begin();
+		for (int i = 0; i < count / 2; ++i)
+			++half;
+		target.Splice(target.End(), source, half, source.End());
+		auto end = std::chrono::steady_clock::now();
+		std::cout << "  Splice half: " << std::chrono::duration<double, std::milli>(end - start).count() << " ms\n";
+
+		List copySource;
+		List copyTarget;
+		for (int i = 0; i < count; ++i)
+			copySource.AddTail(i);
+
+		start = std::chrono::steady_clock::now();
+		std::vector<int> kept;
+		int index = 0;
+		for (Node* curr = copySource.mHead; curr != nullptr; curr = curr->next, ++index) {
+			if (index < count / 2)
+				kept.push_back(curr->data);
+			else
+				copyTarget.AddTail(curr->data);
+		}
+		copySource.Clear();
+		for (int value : kept)
+			copySource.AddTail(value);
+		end = std::chrono::steady_clock::now();
+		std::cout << "  Copy half: " << std::chrono::duration<double, std::milli>(end - start).count() << " ms\n";
+	}
+
+	// Merging two sorted lists of evens and odds
+	{
+		List listA;
+		List listB;
+		for (int i = 0; i < count; ++i)
+			(i % 2 == 0 ? listA : listB).AddTail(i);
+
+		auto start = std::chrono::steady_clock::now();
+		listA.Merge(listB);
+		auto end = std::chrono::steady_clock::now();
+		std::cout << "  Merge: " << std::chrono::duration<double, std::milli>(end - start).count() << " ms\n";
+
+		List copyA;
+		List copyB;
+		for (int i = 0; i < count; ++i)
+			(i % 2 == 0 ? copyA : copyB).AddTail(i);
+
+		start = std::chrono::steady_clock::now();
+		std::vector<int> valuesA;
+		std::vector<int> valuesB;
+		for (Node* curr = copyA.mHead; curr != nullptr; curr = curr->next)
+			valuesA.push_back(curr->data);
+		for (Node* curr = copyB.mHead; curr != nullptr; curr = curr->next)
+			valuesB.push_back(curr->data);
+		std::vector<int> merged(valuesA.size() + valuesB.size());
+		std::merge(valuesA.begin(), valuesA.end(), valuesB.begin(), valuesB.end(), merged.begin());
+		copyA.Clear();
+		copyB.Clear();
+		for (int value : merged)
+			copyA.AddTail(value);
+		end = std::chrono::steady_clock::now();
+		std::cout << "  Copy and std::merge: " << std::chrono::duration<double, std::milli>(end - start).count() << " ms\n";
+	}
+
+	// Sorting a shuffled list
+	{
+		std::vector<int> shuffled(count);
+		for (int& value : shuffled)
+			value = RandomInt(0, count);
+
+		List list;
+		for (int value : shuffled)
+			list.AddTail(value);
+
+		auto start = std::chrono::steady_clock::now();
+		list.Sort();
+		auto end = std::chrono::steady_clock::now();
+		std::cout << "  Sort: " << std::chrono::duration<double, std::milli>(end - start).count() << " ms\n";
+
+		List copyList;
+		for (int value : shuffled)
+			copyList.AddTail(value);
+
+		start = std::chrono::steady_clock::now();
+		std::vector<int> values;
+		for (Node* curr = copyList.mHead; curr != nullptr; curr = curr->next)
+			values.push_back(curr->data);
+		std::sort(values.begin(), values.end());
+		copyList.Clear();
+		for (int value : values)
+			copyList.AddTail(value);
+		end = std::chrono::steady_clock::now();
+		std::cout << "  Copy and std::sort: " << std::chrono::duration<double, std::milli>(end - start).count() << " ms\n";
+	}
+}
+#endif
+#pragma endregion
 #endif
\ No newline at end of file
@@ -16,6 +16,8 @@ Notes:			Property of Full Sail University
 /************/
 #include "UnitTestHelper.h"
 #include "..\\DList.h"
+#include "..\\IntrusiveDList.h"
+#include "..\\UnrolledDList.h"
 
 class UnitTests_Lab3 {
 #if LAB_3
@@ -23,6 +25,9 @@ public:
 	using List = DList<int>;
 	using Node = List::Node;
 	using Iterator = List::Iterator;
+	using PoolList = DList<int, PoolAllocator<int>>;
+	using PoolNode = PoolList::Node;
+	using UnrolledList = UnrolledDList<int, 4>;
 
 	// Runs all active unit tests
 	static void FullBattery();
@@ -426,4 +431,105 @@ public:
 	static bool Pass_CopyConstructor_ValuesAreTheSameBackwards();
 	static bool Pass_CopyConstructor_SizeIsTheSame();
 #pragma endregion
+#pragma region Test - Move Semantics
+	static void Battery_MoveSemantics();
+
+	static FailResult Fail_MoveSemantics_MemoryIsAllocated();
+	static FailResult Fail_MoveSemantics_NodesAreNotTransferred();
+	static FailResult Fail_MoveSemantics_ArgumentIsNotEmpty();
+
+	static bool Pass_MoveSemantics_NoMemoryAllocated();
+	static bool Pass_MoveSemantics_NodesAreTransferred();
+	static bool Pass_MoveSemantics_ArgumentIsEmpty();
+#pragma endregion
+#pragma region Test - Stress
+	static void Battery_Stress();
+
+	static FailResult Fail_Stress_ClearLeaksNodes();
+	static FailResult Fail_Stress_ClearDoesNotResetList();
+	static FailResult Fail_Stress_CopyIsTruncated();
+	static FailResult Fail_Stress_AssignmentLeaksOldNodes();
+
+	static bool Pass_Stress_ClearFreesAllMemory();
+	static bool Pass_Stress_CopyIsTheSame();
+#pragma endregion
+#pragma region Test - UnrolledDList
+	static void Battery_UnrolledDList();
+
+	static FailResult Fail_UnrolledDList_AddTailDoesNotFillNodes();
+	static FailResult Fail_UnrolledDList_AddHeadOrderIsWrong();
+	static FailResult Fail_UnrolledDList_InsertDoesNotSplitFullNode();
+	static FailResult Fail_UnrolledDList_EraseDoesNotMergeNodes();
+	static FailResult Fail_UnrolledDList_EraseDoesNotFreeEmptyNode();
+	static FailResult Fail_UnrolledDList_DecrementDoesNotCrossNodes();
+	static FailResult Fail_UnrolledDList_CopySharesNodes();
+	static FailResult Fail_UnrolledDList_RemoveIfLeaksNodes();
+
+	static bool Pass_UnrolledDList_AddHeadAndAddTailAreCorrect();
+	static bool Pass_UnrolledDList_InsertIsCorrect();
+	static bool Pass_UnrolledDList_EraseIsCorrect();
+	static bool Pass_UnrolledDList_IteratorsAreCorrect();
+	static bool Pass_UnrolledDList_CopyIsCorrect();
+	static bool Pass_UnrolledDList_RemoveIfIsCorrect();
+#pragma endregion
+#pragma region Test - IntrusiveDList
+	static void Battery_IntrusiveDList();
+
+	static FailResult Fail_IntrusiveDList_AddAllocates();
+	static FailResult Fail_IntrusiveDList_AddTailLinksWrongNeighbours();
+	static FailResult Fail_IntrusiveDList_RemoveOnEmptyIsNotNull();
+	static FailResult Fail_IntrusiveDList_RemoveHeadLeavesHookLinked();
+	static FailResult Fail_IntrusiveDList_InsertAtBeginMissesHead();
+	static FailResult Fail_IntrusiveDList_EraseTailMissesEnd();
+	static FailResult Fail_IntrusiveDList_OtherHookChanged();
+	static FailResult Fail_IntrusiveDList_DestructorLeavesHooksLinked();
+
+	static bool Pass_IntrusiveDList_AddAndRemoveAreCorrect();
+	static bool Pass_IntrusiveDList_InsertIsCorrect();
+	static bool Pass_IntrusiveDList_EraseIsCorrect();
+	static bool Pass_IntrusiveDList_TwoHooksAreIndependent();
+	static bool Pass_IntrusiveDList_ClearResetsHooks();
+#pragma endregion
+
+#pragma region Test - Pool Allocator
+	static void Battery_PoolAllocator();
+
+	static FailResult Fail_PoolAllocator_NodesComeFromTheHeap();
+	static FailResult Fail_PoolAllocator_ClearLeaksNodes();
+	static FailResult Fail_PoolAllocator_DestructorLeaksNodes();
+	static FailResult Fail_PoolAllocator_CopyAssignKeepsOldPool();
+	static FailResult Fail_PoolAllocator_MoveAssignCopiesNodes();
+	static FailResult Fail_PoolAllocator_SwapKeepsOldPools();
+
+	static bool Pass_PoolAllocator_ErasedNodeIsReused();
+	static bool Pass_PoolAllocator_ChurnKeepsValues();
+	static bool Pass_PoolAllocator_CopyIsIndependent();
+	static bool Pass_PoolAllocator_AllMemoryIsReturned();
+#pragma endregion
+
+#pragma region Test - Splice Merge Sort
+	static void Battery_SpliceMergeSort();
+
+	static FailResult Fail_SpliceMergeSort_WholeListSizesAreWrong();
+	static FailResult Fail_SpliceMergeSort_RangeAcrossListsSizesAreWrong();
+	static FailResult Fail_SpliceMergeSort_NodeAcrossListsSizesAreWrong();
+	static FailResult Fail_SpliceMergeSort_LinksAreBroken();
+	static FailResult Fail_SpliceMergeSort_NoOpChangesList();
+	static FailResult Fail_SpliceMergeSort_MergeIsNotStable();
+	static FailResult Fail_SpliceMergeSort_SortIsNotStable();
+	static FailResult Fail_SpliceMergeSort_NodesAreAllocatedOrReplaced();
+
+	static bool Pass_SpliceMergeSort_RangeWithinListMovesToEnd();
+	static bool Pass_SpliceMergeSort_SpliceIntoEmptyList();
+	static bool Pass_SpliceMergeSort_MergeWithEmptyLists();
+	static bool Pass_SpliceMergeSort_SortMatchesBucketedOrder();
+#pragma endregion
+
+#pragma region Benchmark - Pool Churn
+	static void Benchmark_PoolChurn();
+#pragma endregion
+
+#pragma region Benchmark - Splice Merge Sort
+	static void Benchmark_SpliceMergeSort();
+#pragma endregion
 };
\ No newline at end of file
@@ -13,6 +13,12 @@ Notes:			Property of Full Sail University
 /* Includes */
 /************/
 #include "UnitTests_Lab4.h"
+#include "Memory_Management.h"
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <mutex>
 
 #if LAB_4
 void UnitTests_Lab4::FullBattery() {
@@ -37,6 +43,21 @@ void UnitTests_Lab4::FullBattery() {
 #if LAB4_REMOVE_DECIMAL
 	Battery_RemoveDecimalGreater();
 #endif
+#if LAB4_MPMC
+	Battery_MPMCQueues();
+#endif
+#if LAB4_MPMC_BENCHMARK
+	Benchmark_MPMCQueues();
+#endif
+#if LAB4_INDEXED_SEQUENCE
+	Battery_IndexedSequence();
+#endif
+#if LAB4_RING_DEQUE
+	Battery_RingDeque();
+#endif
+#if LAB4_DECIMAL_FILTER
+	Battery_DecimalFilter();
+#endif
 }
 
 #pragma region Test - Add Queue Ordering
@@ -1109,4 +1130,1201 @@ bool UnitTests_Lab4::Pass_RemoveDecimalGreaterRandom_CorrectValueReturned() {
 #pragma endregion
 #endif
 #pragma endregion
+
+#pragma region Test - MPMC Queues
+#if LAB4_MPMC || LAB4_MPMC_BENCHMARK
+// Runs producers and consumers on one queue at the same time
+//		Each producer pushes _count values of its own (producer * _count + i), and the
+//		consumers pop until every value has come out
+//
+// In:	_push			Pushes a value (returns false if the queue was full)
+//		_pop			Pops a value (returns false if the queue was empty)
+//		_producers		The number of producer threads
+//		_consumers		The number of consumer threads
+//		_count			The number of values each producer pushes
+//
+// Return: True, if every value was popped exactly once, and each consumer saw
+//		each producer's values in the order they were pushed
+template<typename Push, typename Pop>
+static bool MPMCRunThreads(Push _push, Pop _pop, int _producers, int _consumers, int _count) {
+	int total = _producers * _count;
+	std::vector<std::atomic<int>> timesPopped(total);
+	std::atomic<int> popped{ 0 };
+	std::atomic<bool> inOrder{ true };
+
+	{
+		std::vector<std::thread> threads;
+		for (int p = 0; p < _producers; ++p) {
+			threads.emplace_back([&, p]() {
+				for (int i = 0; i < _count; ++i) {
+					while (!_push(p * _count + i))
+						std::this_thread::yield();
+				}
+			});
+		}
+		for (int c = 0; c < _consumers; ++c) {
+			threads.emplace_back([&]() {
+				std::vector<int> lastSeen(_producers, -1);
+				int value;
+				while (popped.load() < total) {
+					if (!_pop(value)) {
+						std::this_thread::yield();
+						continue;
+					}
+					++timesPopped[value];
+					++popped;
+					if (value <= lastSeen[value / _count])
+						inOrder = false;
+					lastSeen[value / _count] = value;
+				}
+			});
+		}
+		for (std::thread& thread : threads)
+			thread.join();
+	}
+
+	bool result = inOrder && popped.load() == total;
+	for (int i = 0; i < total && result; ++i)
+		result = timesPopped[i].load() == 1;
+
+	return result;
+}
+#endif
+
+#if LAB4_MPMC
+void UnitTests_Lab4::Battery_MPMCQueues() {
+	FailVector failVec;
+	failVec.push_back(Fail_MPMCQueues_BoundedCapacityIsWrong);
+	failVec.push_back(Fail_MPMCQueues_BoundedPopOnEmptySucceeds);
+	failVec.push_back(Fail_MPMCQueues_BoundedOrderIsWrongAfterWrap);
+	failVec.push_back(Fail_MPMCQueues_SegmentedOrderIsWrongAcrossSegments);
+	failVec.push_back(Fail_MPMCQueues_SegmentedKeepsDrainedSegments);
+	failVec.push_back(Fail_MPMCQueues_SegmentedDestructorLeaksValues);
+
+	PassVector passVec;
+	passVec.push_back(Pass_MPMCQueues_BoundedEveryValuePoppedOnce);
+	passVec.push_back(Pass_MPMCQueues_SegmentedEveryValuePoppedOnce);
+	passVec.push_back(Pass_MPMCQueues_SegmentedMemoryIsRestored);
+
+	UnitTestBattery("Testing MPMC queues with several producer and consumer threads", failVec, passVec);
+}
+
+#pragma region Fail Tests
+FailResult UnitTests_Lab4::Fail_MPMCQueues_BoundedCapacityIsWrong() {
+	BoundedMPMCQueue<int> queue(5);
+	bool pushed = true;
+	for (int i = 0; i < 8; ++i)
+		pushed = queue.TryPush(i) && pushed;
+
+	FailResult result;
+	result.check = queue.Capacity() != 8 || !pushed || queue.TryPush(8);
+	result.msg = "Bounded queue did not round its capacity up to a power of 2, or took a value when full";
+
+	return result;
+}
+
+FailResult UnitTests_Lab4::Fail_MPMCQueues_BoundedPopOnEmptySucceeds() {
+	BoundedMPMCQueue<int> queue(4);
+	int value = -1;
+	bool poppedEmpty = queue.TryPop(value);
+	queue.TryPush(1);
+	queue.TryPop(value);
+
+	FailResult result;
+	result.check = poppedEmpty || queue.TryPop(value);
+	result.msg = "Bounded queue popped a value when it was empty";
+
+	return result;
+}
+
+FailResult UnitTests_Lab4::Fail_MPMCQueues_BoundedOrderIsWrongAfterWrap() {
+	BoundedMPMCQueue<int> queue(4);
+	bool inOrder = true;
+
+	// Three values a lap, so the front moves around the ring
+	int next = 0;
+	for (int lap = 0; lap < 10; ++lap) {
+		for (int i = 0; i < 3; ++i)
+			queue.TryPush(lap * 3 + i);
+		int value = -1;
+		for (int i = 0; i < 3; ++i)
+			inOrder = queue.TryPop(value) && value == next++ && inOrder;
+	}
+
+	FailResult result;
+	result.check = !inOrder;
+	result.msg = "Bounded queue returned values out of order after wrapping around";
+
+	return result;
+}
+
+FailResult UnitTests_Lab4::Fail_MPMCQueues_SegmentedOrderIsWrongAcrossSegments() {
+	SegmentedMPMCQueue<int, 4> queue;
+	for (int i = 0; i < 10; ++i)
+		queue.Push(i);
+
+	bool inOrder = true;
+	int value = -1;
+	for (int i = 0; i < 10; ++i)
+		inOrder = queue.TryPop(value) && value == i && inOrder;
+
+	FailResult result;
+	result.check = !inOrder || queue.TryPop(value);
+	result.msg = "Segmented queue returned values out of order across segments, or popped one too many";
+
+	return result;
+}
+
+FailResult UnitTests_Lab4::Fail_MPMCQueues_SegmentedKeepsDrainedSegments() {
+	size_t memoryStart = inUse;
+	SegmentedMPMCQueue<int, 4> queue;
+	size_t memoryOneSegment = inUse - memoryStart;
+
+	// 250 segments are used up one after another
+	int value;
+	for (int i = 0; i < 1000; ++i) {
+		queue.Push(i);
+		queue.TryPop(value);
+	}
+
+	// The current segment plus at most three epochs of retired ones
+	FailResult result;
+	result.check = inUse - memoryStart > memoryOneSegment * 5;
+	result.msg = "Segmented queue kept drained segments instead of freeing them";
+
+	return result;
+}
+
+FailResult UnitTests_Lab4::Fail_MPMCQueues_SegmentedDestructorLeaksValues() {
+	size_t memoryStart = inUse;
+	{
+		SegmentedMPMCQueue<std::vector<int>, 4> queue;
+		for (int i = 0; i < 6; ++i)
+			queue.Push(std::vector<int>(10, i));
+	}
+
+	FailResult result;
+	result.check = inUse != memoryStart;
+	result.msg = "Segmented queue's destructor did not free the values and segments still in it";
+
+	return result;
+}
+#pragma endregion
+
+#pragma region Pass Tests
+// Pushes and pops from several threads through a small bounded queue (so it wraps and fills up)
+//		inUse is not atomic and the threads allocate and free at the same time, so it is
+//		put back once the queue is gone (everything allocated by then has been freed)
+bool UnitTests_Lab4::Pass_MPMCQueues_BoundedEveryValuePoppedOnce() {
+	size_t memoryStart = inUse;
+	bool result;
+	{
+		BoundedMPMCQueue<int> queue(64);
+		result = MPMCRunThreads([&](int _val) { return queue.TryPush(_val); },
+			[&](int& _val) { return queue.TryPop(_val); }, 3, 3, 20000);
+	}
+	inUse = memoryStart;
+
+	return result;
+}
+
+// Pushes and pops from several threads through a queue with small segments (so many are linked and retired)
+//		(inUse is put back afterwards, as above)
+bool UnitTests_Lab4::Pass_MPMCQueues_SegmentedEveryValuePoppedOnce() {
+	size_t memoryStart = inUse;
+	bool result;
+	{
+		SegmentedMPMCQueue<int, 16> queue;
+		result = MPMCRunThreads([&](int _val) { queue.Push(_val); return true; },
+			[&](int& _val) { return queue.TryPop(_val); }, 3, 3, 20000);
+	}
+	inUse = memoryStart;
+
+	return result;
+}
+
+// Single-threaded run across many segments, destroying the queue with values still in it
+bool UnitTests_Lab4::Pass_MPMCQueues_SegmentedMemoryIsRestored() {
+	size_t memoryStart = inUse;
+	bool inOrder = true;
+	{
+		SegmentedMPMCQueue<std::vector<int>, 4> queue;
+		for (int i = 0; i < 100; ++i)
+			queue.Push(std::vector<int>(10, i));
+
+		std::vector<int> value;
+		for (int i = 0; i < 90; ++i)
+			inOrder = queue.TryPop(value) && value.size() == 10 && value[0] == i && inOrder;
+	}
+	return inOrder && inUse == memoryStart;
+}
+#pragma endregion
+#endif
+
+#if LAB4_MPMC_BENCHMARK
+// Times 2, 4 and 8 threads (half producers, half consumers) moving values through
+// each MPMC queue and through a std::list guarded by a mutex
+//		The numbers only mean something on a machine with that many cores
+void UnitTests_Lab4::Benchmark_MPMCQueues() {
+	size_t memoryStart = inUse;
+	const int count = 250000;
+	std::cout << "Benchmarking MPMC queues against a mutex-guarded std::list (" << count << " values per producer)\n";
+
+	for (int threads = 2; threads <= 8; threads *= 2) {
+		int producers = threads / 2;
+
+		BoundedMPMCQueue<int> bounded(1024);
+		SegmentedMPMCQueue<int> segmented;
+		std::mutex mutex;
+		std::list<int> list;
+
+		auto time = [&](const char* _name, auto _push, auto _pop) {
+			auto start = std::chrono::steady_clock::now();
+			bool correct = MPMCRunThreads(_push, _pop, producers, producers, count);
+			auto end = std::chrono::steady_clock::now();
+
+			std::cout << "  " << threads << " threads, " << _name << ": "
+				<< std::chrono::duration<double, std::milli>(end - start).count() << " ms"
+				<< (correct ? "\n" : " (values lost or duplicated)\n");
+		};
+
+		time("BoundedMPMCQueue",
+			[&](int _val) { return bounded.TryPush(_val); },
+			[&](int& _val) { return bounded.TryPop(_val); });
+		time("SegmentedMPMCQueue",
+			[&](int _val) { segmented.Push(_val); return true; },
+			[&](int& _val) { return segmented.TryPop(_val); });
+		time("std::list + mutex",
+			[&](int _val) { std::lock_guard<std::mutex> lock(mutex); list.push_back(_val); return true; },
+			[&](int& _val) {
+				std::lock_guard<std::mutex> lock(mutex);
+				if (list.empty())
+					return false;
+				_val = list.front();
+				list.pop_front();
+				return true;
+			});
+	}
+
+	// inUse is not atomic, so the threads can leave it off (everything has been freed by now)
+	inUse = memoryStart;
+}
+#endif
+#pragma endregion
+
+#pragma region Test - IndexedSequence
+#if LAB4_INDEXED_SEQUENCE
+void UnitTests_Lab4::Battery_IndexedSequence() {
+	FailVector failVec;
+	failVec.push_back(Fail_IndexedSequence_InsertAtEndsIsMisplaced);
+	failVec.push_back(Fail_IndexedSequence_InsertInMiddleIsMisplaced);
+	failVec.push_back(Fail_IndexedSequence_EraseLeavesCountsWrong);
+	failVec.push_back(Fail_IndexedSequence_CopySharesNodes);
+	failVec.push_back(Fail_IndexedSequence_ClearLeaksNodes);
+	failVec.push_back(Fail_IndexedSequence_AssignmentLeaksOldNodes);
+
+	PassVector passVec;
+	passVec.push_back(Pass_IndexedSequence_ValuesMatchVector);
+	passVec.push_back(Pass_IndexedSequence_CopyMatches);
+	passVec.push_back(Pass_IndexedSequence_MemoryIsRestored);
+
+	UnitTestBattery("Testing IndexedSequence against std::vector", failVec, passVec);
+}
+
+// Checks that a sequence holds the same values as a vector, through CopyTo and operator[]
+static bool SequenceMatches(const IndexedSequence<float>& _sequence, const std::vector<float>& _values) {
+	if (_sequence.Size() != _values.size())
+		return false;
+
+	std::vector<float> copied(_values.size());
+	_sequence.CopyTo(copied.data());
+	if (copied != _values)
+		return false;
+
+	for (size_t i = 0; i < _values.size(); i += 7) {
+		if (_sequence[(int)i] != _values[i])
+			return false;
+	}
+	return true;
+}
+
+// Random positional inserts and erases, mirrored into a vector
+//
+// In:	_sequence		The sequence to change
+//		_values			The vector to mirror the changes into
+//		_operations		The number of inserts and erases to do
+//
+// Return: True, if the sequence matched the vector after every step
+static bool SequenceRandomEdits(IndexedSequence<float>& _sequence, std::vector<float>& _values, int _operations) {
+	for (int i = 0; i < _operations; ++i) {
+		// Inserts twice as often as erases, so the sequence grows
+		if (_values.empty() || RandomInt(0, 2) != 0) {
+			int index = RandomInt(0, (int)_values.size());
+			float value = RandomFloat(-100, 100);
+			_sequence.Insert(index, value);
+			_values.insert(_values.begin() + index, value);
+		}
+		else {
+			int index = RandomInt(0, (int)_values.size() - 1);
+			_sequence.Erase(index);
+			_values.erase(_values.begin() + index);
+		}
+
+		if ((i % 50 == 0 || i == _operations - 1) && !SequenceMatches(_sequence, _values))
+			return false;
+	}
+	return true;
+}
+
+#pragma region Fail Tests
+FailResult UnitTests_Lab4::Fail_IndexedSequence_InsertAtEndsIsMisplaced() {
+	IndexedSequence<float> sequence;
+	for (int i = 0; i < 3; ++i) {
+		sequence.Insert(0, (float)-i);
+		sequence.Insert((int)sequence.Size(), (float)(i + 10));
+	}
+
+	FailResult result;
+	result.check = !SequenceMatches(sequence, { -2.0f, -1.0f, 0.0f, 10.0f, 11.0f, 12.0f });
+	result.msg = "Inserting at index 0 or at Size() did not add to the front or the back";
+
+	return result;
+}
+
+FailResult UnitTests_Lab4::Fail_IndexedSequence_InsertInMiddleIsMisplaced() {
+	IndexedSequence<float> sequence;
+	for (int i = 0; i < 4; ++i)
+		sequence.Insert(i, (float)i);
+
+	sequence.Insert(2, 9.0f);
+
+	FailResult result;
+	result.check = sequence[2] != 9.0f || sequence[3] != 2.0f || !SequenceMatches(sequence, { 0.0f, 1.0f, 9.0f, 2.0f, 3.0f });
+	result.msg = "Inserting in the middle did not put the value in front of the one at that index";
+
+	return result;
+}
+
+FailResult UnitTests_Lab4::Fail_IndexedSequence_EraseLeavesCountsWrong() {
+	IndexedSequence<float> sequence;
+	for (int i = 0; i < 100; ++i)
+		sequence.Insert(i, (float)i);
+
+	for (int i = 0; i < 10; ++i)
+		sequence.Erase(50);
+
+	FailResult result;
+	result.check = sequence.Size() != 90 || sequence[49] != 49.0f || sequence[50] != 60.0f || sequence[89] != 99.0f;
+	result.msg = "Erase did not keep the subtree counts right, so later indexes found the wrong value";
+
+	return result;
+}
+
+FailResult UnitTests_Lab4::Fail_IndexedSequence_CopySharesNodes() {
+	IndexedSequence<float> sequence;
+	for (int i = 0; i < 20; ++i)
+		sequence.Insert(i, (float)i);
+
+	IndexedSequence<float> copy(sequence);
+	IndexedSequence<float> assigned;
+	assigned = sequence;
+	copy[0] = -1.0f;
+	assigned[19] = -1.0f;
+
+	FailResult result;
+	result.check = sequence[0] != 0.0f || sequence[19] != 19.0f;
+	result.msg = "The copy constructor or assignment operator shared nodes with the original";
+
+	// Preventing crash (the shared nodes would be freed twice)
+	if (copy.mRoot == sequence.mRoot)
+		copy.mRoot = nullptr;
+	if (assigned.mRoot == sequence.mRoot)
+		assigned.mRoot = nullptr;
+
+	return result;
+}
+
+FailResult UnitTests_Lab4::Fail_IndexedSequence_ClearLeaksNodes() {
+	size_t memoryStart = inUse;
+	IndexedSequence<float> sequence;
+	for (int i = 0; i < 100; ++i)
+		sequence.Insert(i / 2, (float)i);
+
+	sequence.Clear();
+
+	FailResult result;
+	result.check = inUse != memoryStart || sequence.Size() != 0;
+	result.msg = "Clear did not free every node";
+
+	return result;
+}
+
+FailResult UnitTests_Lab4::Fail_IndexedSequence_AssignmentLeaksOldNodes() {
+	size_t memoryStart = inUse;
+	IndexedSequence<float> sequence;
+	for (int i = 0; i < 20; ++i)
+		sequence.Insert(i, (float)i);
+	size_t memoryOneSequence = inUse - memoryStart;
+
+	IndexedSequence<float> assigned;
+	for (int i = 0; i < 50; ++i)
+		assigned.Insert(i, (float)-i);
+	assigned = sequence;
+
+	FailResult result;
+	result.check = inUse - memoryStart != memoryOneSequence * 2;
+	result.msg = "Assignment did not free the sequence's old nodes";
+
+	return result;
+}
+#pragma endregion
+
+#pragma region Pass Tests
+// Values match the vector after random edits, and after erasing back down to empty
+bool UnitTests_Lab4::Pass_IndexedSequence_ValuesMatchVector() {
+	IndexedSequence<float> sequence;
+	std::vector<float> values;
+	bool result = SequenceMatches(sequence, values) && SequenceRandomEdits(sequence, values, 2000);
+
+	while (!values.empty() && result) {
+		int index = RandomInt(0, (int)values.size() - 1);
+		sequence.Erase(index);
+		values.erase(values.begin() + index);
+		result = values.size() % 25 != 0 || SequenceMatches(sequence, values);
+	}
+	return result && sequence.Size() == 0;
+}
+
+// Copy constructor and assignment operator (including self-assignment) make separate sequences
+bool UnitTests_Lab4::Pass_IndexedSequence_CopyMatches() {
+	IndexedSequence<float> sequence;
+	std::vector<float> values;
+	bool result = SequenceRandomEdits(sequence, values, 500);
+
+	IndexedSequence<float> copy(sequence);
+	IndexedSequence<float> assigned;
+	assigned.Insert(0, -1.0f);
+	assigned = sequence;
+	IndexedSequence<float>& self = assigned;
+	assigned = self;
+	result = result && SequenceMatches(copy, values) && SequenceMatches(assigned, values);
+
+	// Changing a copy leaves the original alone
+	std::vector<float> copyValues = values;
+	result = result && SequenceRandomEdits(copy, copyValues, 200);
+	return result && SequenceMatches(sequence, values);
+}
+
+// Clear frees every node, and so does the destructor
+bool UnitTests_Lab4::Pass_IndexedSequence_MemoryIsRestored() {
+	size_t memoryStart = inUse;
+	bool result;
+	{
+		IndexedSequence<float> sequence;
+		std::vector<float> values;
+		SequenceRandomEdits(sequence, values, 1000);
+		values.clear();
+		values.shrink_to_fit();
+
+		sequence.Clear();
+		result = inUse == memoryStart && sequence.Size() == 0;
+
+		SequenceRandomEdits(sequence, values, 1000);
+		IndexedSequence<float> copy(sequence);
+		values.clear();
+		values.shrink_to_fit();
+	}
+	return result && inUse == memoryStart;
+}
+#pragma endregion
+#endif
+#pragma endregion
+
+#pragma region Test - RingDeque
+#if LAB4_RING_DEQUE
+void UnitTests_Lab4::Battery_RingDeque() {
+	FailVector failVec;
+	failVec.push_back(Fail_RingDeque_QueueAddDoesNotWrap);
+	failVec.push_back(Fail_RingDeque_StackAddDoesNotWrap);
+	failVec.push_back(Fail_RingDeque_BatchRemoveTakesTooMany);
+	failVec.push_back(Fail_RingDeque_GrowsAtWrongSize);
+	failVec.push_back(Fail_RingDeque_GrowingUnwrapsWrongly);
+	failVec.push_back(Fail_RingDeque_MoveCopiesBuffer);
+	failVec.push_back(Fail_RingDeque_SwapKeepsBuffers);
+
+	PassVector passVec;
+	passVec.push_back(Pass_RingDeque_QueueOrderingAcrossWrapIsCorrect);
+	passVec.push_back(Pass_RingDeque_StackOrderingAcrossWrapIsCorrect);
+	passVec.push_back(Pass_RingDeque_GrowingWhileWrappedKeepsValues);
+	passVec.push_back(Pass_RingDeque_MoveAndSwapAreCorrect);
+
+	UnitTestBattery("Testing RingDeque", failVec, passVec);
+}
+
+// Smallest capacity a RingDeque allocates
+const size_t ringCapacity = 16;
+
+// Checks that a deque holds the same values as a std::list, front to back
+static bool RingMatches(const RingDeque<float>& _deque, const std::list<float>& _values) {
+	if (_deque.Size() != _values.size())
+		return false;
+
+	size_t i = 0;
+	for (float value : _values) {
+		if (_deque[i++] != value)
+			return false;
+	}
+	return true;
+}
+
+// Makes a deque with its front _offset slots into a 16 slot buffer, holding _count values
+static void RingStartAt(RingDeque<float>& _deque, std::list<float>& _values, size_t _offset, size_t _count) {
+	_deque.Reserve(ringCapacity);
+	for (size_t i = 0; i < _offset; ++i)
+		_deque.PushBack(0);
+	for (size_t i = 0; i < _offset; ++i)
+		_deque.PopFront();
+
+	for (size_t i = 0; i < _count; ++i) {
+		_deque.PushBack((float)i);
+		_values.push_back((float)i);
+	}
+}
+
+// Adds and removes batches with queue or stack ordering from every starting slot,
+// so the batches start, end and straddle the wrap point everywhere they can
+//
+// In:	_stack		True for stack ordering, false for queue ordering
+//
+// Return: True, if the values matched std::list push_back/push_front every time
+static bool RingOrderingAcrossWrap(bool _stack) {
+	float batch[ringCapacity];
+	float removed[ringCapacity];
+	for (size_t i = 0; i < ringCapacity; ++i)
+		batch[i] = 100.0f + i;
+
+	for (size_t offset = 0; offset < ringCapacity; ++offset) {
+		for (size_t count = 0; count <= 3; ++count) {
+			for (size_t size = 1; size + count <= ringCapacity; ++size) {
+				RingDeque<float> deque;
+				std::list<float> values;
+				RingStartAt(deque, values, offset, count);
+
+				if (_stack) {
+					deque.StackOrderingAdd(batch, size);
+					for (size_t i = 0; i < size; ++i)
+						values.push_front(batch[i]);
+				}
+				else {
+					deque.QueueOrderingAdd(batch, size);
+					values.insert(values.end(), batch, batch + size);
+				}
+
+				if (deque.Capacity() != ringCapacity || !RingMatches(deque, values))
+					return false;
+
+				// Take one off singly, then the rest as a batch (asking for more than there are)
+				float first = _stack ? deque.StackOrderingRemove() : deque.QueueOrderingRemove();
+				size_t left = deque.Size();
+				size_t taken = _stack ? deque.StackOrderingRemove(removed, ringCapacity) : deque.QueueOrderingRemove(removed, ringCapacity);
+				if (first != values.front() || taken != left || deque.Size() != 0)
+					return false;
+
+				values.pop_front();
+				size_t i = 0;
+				for (float value : values) {
+					if (removed[i++] != value)
+						return false;
+				}
+			}
+		}
+	}
+	return true;
+}
+
+#pragma region Fail Tests
+FailResult UnitTests_Lab4::Fail_RingDeque_QueueAddDoesNotWrap() {
+	RingDeque<float> deque;
+	std::list<float> values;
+	RingStartAt(deque, values, 14, 0);
+
+	// Two values fit before the end of the buffer, the other three go at the start
+	const float batch[] = { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f };
+	deque.QueueOrderingAdd(batch, 5);
+	values.assign(batch, batch + 5);
+
+	FailResult result;
+	result.check = deque.Capacity() != ringCapacity || !RingMatches(deque, values);
+	result.msg = "Queue ordering add did not carry a batch past the end of the buffer round to its start";
+
+	return result;
+}
+
+FailResult UnitTests_Lab4::Fail_RingDeque_StackAddDoesNotWrap() {
+	RingDeque<float> deque;
+	std::list<float> values;
+	RingStartAt(deque, values, 2, 1);
+
+	// Two values fit below the front, the other three go at the end of the buffer
+	const float batch[] = { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f };
+	deque.StackOrderingAdd(batch, 5);
+	values = { 5.0f, 4.0f, 3.0f, 2.0f, 1.0f, 0.0f };
+
+	FailResult result;
+	result.check = deque.Capacity() != ringCapacity || !RingMatches(deque, values);
+	result.msg = "Stack ordering add did not put a batch that wraps below the first slot on the front in reverse";
+
+	return result;
+}
+
+FailResult UnitTests_Lab4::Fail_RingDeque_BatchRemoveTakesTooMany() {
+	RingDeque<float> deque;
+	std::list<float> values;
+	RingStartAt(deque, values, 15, 3);
+
+	float removed[8] = {};
+	size_t taken = deque.QueueOrderingRemove(removed, 8);
+	size_t takenEmpty = deque.StackOrderingRemove(removed, 8);
+
+	FailResult result;
+	result.check = taken != 3 || takenEmpty != 0 || deque.Size() != 0 ||
+		removed[0] != 0.0f || removed[1] != 1.0f || removed[2] != 2.0f;
+	result.msg = "Removing a batch larger than the deque did not stop at the values it had";
+
+	return result;
+}
+
+FailResult UnitTests_Lab4::Fail_RingDeque_GrowsAtWrongSize() {
+	RingDeque<float> deque;
+	for (int i = 0; i < 16; ++i)
+		deque.PushBack((float)i);
+	size_t fullCapacity = deque.Capacity();
+	deque.PushFront(-1.0f);
+
+	FailResult result;
+	result.check = fullCapacity != ringCapacity || deque.Capacity() != ringCapacity * 2 ||
+		deque[0] != -1.0f || deque[16] != 15.0f;
+	result.msg = "The deque grew before its buffer was full, or did not double when it was";
+
+	return result;
+}
+
+FailResult UnitTests_Lab4::Fail_RingDeque_GrowingUnwrapsWrongly() {
+	RingDeque<float> deque;
+	std::list<float> values;
+	RingStartAt(deque, values, 12, 0);
+	for (int i = 0; i < 16; ++i) {
+		deque.PushBack(100.0f + i);
+		values.push_back(100.0f + i);
+	}
+
+	// The full buffer wraps after four values, so growing has to copy it in two runs
+	deque.PushBack(116.0f);
+	values.push_back(116.0f);
+
+	FailResult result;
+	result.check = deque.Capacity() != ringCapacity * 2 || !RingMatches(deque, values);
+	result.msg = "Growing a wrapped buffer lost or reordered values";
+
+	return result;
+}
+
+FailResult UnitTests_Lab4::Fail_RingDeque_MoveCopiesBuffer() {
+	RingDeque<float> deque;
+	std::list<float> values;
+	RingStartAt(deque, values, 5, 8);
+	const float* buffer = &deque[0];
+
+	size_t memoryStart = inUse;
+	RingDeque<float> moved(std::move(deque));
+
+	FailResult result;
+	result.check = inUse != memoryStart || &moved[0] != buffer || deque.Capacity() != 0 || deque.Size() != 0;
+	result.msg = "Moving a deque copied its buffer, or left the source holding it";
+
+	return result;
+}
+
+FailResult UnitTests_Lab4::Fail_RingDeque_SwapKeepsBuffers() {
+	RingDeque<float> dequeA;
+	RingDeque<float> dequeB;
+	std::list<float> valuesA;
+	std::list<float> valuesB;
+	RingStartAt(dequeA, valuesA, 3, 4);
+	RingStartAt(dequeB, valuesB, 9, 7);
+	const float* bufferA = &dequeA[0];
+
+	dequeA.Swap(dequeB);
+
+	FailResult result;
+	result.check = &dequeB[0] != bufferA || !RingMatches(dequeA, valuesB) || !RingMatches(dequeB, valuesA);
+	result.msg = "Swap did not exchange the deques' buffers";
+
+	return result;
+}
+#pragma endregion
+
+#pragma region Pass Tests
+bool UnitTests_Lab4::Pass_RingDeque_QueueOrderingAcrossWrapIsCorrect() {
+	return RingOrderingAcrossWrap(false);
+}
+
+bool UnitTests_Lab4::Pass_RingDeque_StackOrderingAcrossWrapIsCorrect() {
+	return RingOrderingAcrossWrap(true);
+}
+
+// Growing a wrapped buffer keeps the values in order
+bool UnitTests_Lab4::Pass_RingDeque_GrowingWhileWrappedKeepsValues() {
+	RingDeque<float> deque;
+	std::list<float> values;
+	RingStartAt(deque, values, 12, 10);
+
+	float batch[40];
+	for (int i = 0; i < 40; ++i)
+		batch[i] = 100.0f + i;
+
+	deque.QueueOrderingAdd(batch, 20);
+	values.insert(values.end(), batch, batch + 20);
+	bool result = deque.Capacity() == 32 && RingMatches(deque, values);
+
+	deque.StackOrderingAdd(batch + 20, 20);
+	for (int i = 20; i < 40; ++i)
+		values.push_front(batch[i]);
+
+	return result && deque.Capacity() == 64 && RingMatches(deque, values);
+}
+
+// Move constructor, move assignment and Swap hand over the buffer without allocating,
+// and leave moved-from deques empty and usable
+bool UnitTests_Lab4::Pass_RingDeque_MoveAndSwapAreCorrect() {
+	RingDeque<float> deque;
+	std::list<float> values;
+	RingStartAt(deque, values, 10, 12);
+	const float* buffer = &deque[0];
+
+	RingDeque<float> other;
+	std::list<float> otherValues;
+	RingStartAt(other, otherValues, 3, 5);
+
+	size_t memoryStart = inUse;
+	RingDeque<float> moveTo(std::move(deque));
+	RingDeque<float> assignTo;
+	assignTo = std::move(moveTo);
+	assignTo.Swap(other);
+	bool result = inUse == memoryStart;
+
+	result = result && RingMatches(other, values) && &other[0] == buffer && RingMatches(assignTo, otherValues) &&
+		deque.Size() == 0 && deque.Capacity() == 0 && moveTo.Size() == 0 && moveTo.Capacity() == 0;
+
+	deque.PushBack(1.0f);
+	moveTo.PushFront(2.0f);
+	return result && deque.Size() == 1 && deque[0] == 1.0f && moveTo.Size() == 1 && moveTo.PopBack() == 2.0f;
+}
+#pragma endregion
+#endif
+#pragma endregion
+
+#pragma region Test - DecimalFilter
+#if LAB4_DECIMAL_FILTER
+void UnitTests_Lab4::Battery_DecimalFilter() {
+	FailVector failVec;
+	failVec.push_back(Fail_DecimalFilter_NaNIsRemoved);
+	failVec.push_back(Fail_DecimalFilter_NegativeZeroLosesSign);
+	failVec.push_back(Fail_DecimalFilter_NegativesAreTruncated);
+	failVec.push_back(Fail_DecimalFilter_EqualDecimalIsRemoved);
+	failVec.push_back(Fail_DecimalFilter_TailIsSkipped);
+	failVec.push_back(Fail_DecimalFilter_WritesPastCount);
+	failVec.push_back(Fail_DecimalFilter_CountOnlyDisagreesWithCopy);
+	failVec.push_back(Fail_DecimalFilter_OutOfPlaceChangesInput);
+	failVec.push_back(Fail_DecimalFilter_InPlaceScramblesOrder);
+	failVec.push_back(Fail_DecimalFilter_CountReturnsKept);
+	failVec.push_back(Fail_DecimalFilter_CopyReturnsRemoved);
+	failVec.push_back(Fail_DecimalFilter_RemoveReturnsKept);
+
+	PassVector passVec;
+	passVec.push_back(Pass_DecimalFilter_CountOnlyIsCorrect);
+	passVec.push_back(Pass_DecimalFilter_OutOfPlaceIsCorrect);
+	passVec.push_back(Pass_DecimalFilter_InPlaceIsCorrect);
+	passVec.push_back(Pass_DecimalFilter_PublicCallsAreCorrect);
+
+	UnitTestBattery("Testing DecimalFilter", failVec, passVec);
+}
+
+// The ways a kernel can be called
+enum class DecimalFilterMode { CountOnly, OutOfPlace, InPlace };
+
+// The longest run tested (covers two full AVX-512 blocks, four AVX2 blocks and every tail)
+static const size_t DecimalFilterMaxCount = 33;
+
+// The decimals each run is checked against
+static const float DecimalFilterDecimals[] = { 0.0f, 0.25f, 0.5f, 0.99f };
+
+// Return: Every kernel this CPU can run, other than the scalar one
+static std::vector<DecimalFilterKernel> SupportedDecimalKernels() {
+	std::vector<DecimalFilterKernel> kernels;
+#if SIMD_X86
+	const CpuFeatures& cpu = GetCpuFeatures();
+	if (cpu.sse41)
+		kernels.push_back(FilterDecimalGreaterSSE41);
+	if (cpu.avx2)
+		kernels.push_back(FilterDecimalGreaterAVX2);
+	if (cpu.avx512f)
+		kernels.push_back(FilterDecimalGreaterAVX512);
+#endif
+	kernels.push_back(GetDecimalFilterKernel());
+	return kernels;
+}
+
+// Return: Input values starting at _offset in a fixed pool, mixing kept and removed values
+//		with NaN, infinities, -0.0 and negative numbers in every lane position
+static std::vector<float> DecimalFilterInput(size_t _offset, size_t _count) {
+	const float nan = std::numeric_limits<float>::quiet_NaN();
+	const float inf = std::numeric_limits<float>::infinity();
+	const float pool[] = {
+		1.75f, 2.0f, nan, -0.0f, 0.5f, -1.25f, inf, 3.1f, 0.25f, -inf, 7.99f, 0.0f,
+		-2.5f, 4.6f, -nan, 10.0f, 0.26f, -0.75f, 5.5f, 1e9f, -3.9f, 0.01f, 6.49f, -0.0f,
+		2.51f, inf, 8.0f, -0.1f, 0.99f, nan, 123.456f, -7.0f, 0.74f, 9.999f, -inf, 0.5001f,
+	};
+	const size_t poolSize = sizeof(pool) / sizeof(pool[0]);
+
+	std::vector<float> values(_count);
+	for (size_t i = 0; i < _count; ++i)
+		values[i] = pool[(_offset + i) % poolSize];
+	return values;
+}
+
+// Return: True if the first _count values of both arrays have the same bits
+//		(so NaN matches NaN and -0.0 does not match 0.0)
+static bool DecimalFilterSameBits(const float* _a, const float* _b, size_t _count) {
+	return _count == 0 || std::memcmp(_a, _b, _count * sizeof(float)) == 0;
+}
+
+// Return: Every kernel this CPU can run, including the scalar one
+static std::vector<DecimalFilterKernel> AllDecimalKernels() {
+	std::vector<DecimalFilterKernel> kernels = SupportedDecimalKernels();
+	kernels.insert(kernels.begin(), FilterDecimalGreaterScalar);
+	return kernels;
+}
+
+// Return: The values 0 to _count - 1, with 0.75 added to every multiple of 3
+//		(so with a decimal of 0.5, exactly the multiples of 3 are removed)
+static std::vector<float> DecimalFilterThirdsInput(size_t _count) {
+	std::vector<float> values(_count);
+	for (size_t i = 0; i < _count; ++i)
+		values[i] = (float)i + (i % 3 == 0 ? 0.75f : 0.0f);
+	return values;
+}
+
+// Run one kernel and the scalar kernel over the same input and compare them
+//		Out of place, the output has guard values after _count that must be left alone,
+//		and the input must not change
+static bool DecimalKernelMatchesScalar(DecimalFilterKernel _kernel, DecimalFilterMode _mode,
+	const std::vector<float>& _input, float _decimal) {
+	const float guard = -12345.0f;
+	size_t count = _input.size();
+
+	std::vector<float> expected(count);
+	size_t expectedKept = FilterDecimalGreaterScalar(_input.data(), count, _decimal, expected.data());
+
+	switch (_mode)
+	{
+	case DecimalFilterMode::CountOnly:
+		return _kernel(_input.data(), count, _decimal, nullptr) == expectedKept;
+
+	case DecimalFilterMode::OutOfPlace:
+	{
+		std::vector<float> in = _input;
+		std::vector<float> out(count + 16, guard);
+		size_t kept = _kernel(in.data(), count, _decimal, out.data());
+
+		for (size_t i = count; i < out.size(); ++i)
+			if (out[i] != guard)
+				return false;
+		return kept == expectedKept && DecimalFilterSameBits(out.data(), expected.data(), kept) &&
+			DecimalFilterSameBits(in.data(), _input.data(), count);
+	}
+
+	case DecimalFilterMode::InPlace:
+	{
+		std::vector<float> values = _input;
+		values.resize(count + 16, guard);
+		size_t kept = _kernel(values.data(), count, _decimal, values.data());
+
+		for (size_t i = count; i < values.size(); ++i)
+			if (values[i] != guard)
+				return false;
+		return kept == expectedKept && DecimalFilterSameBits(values.data(), expected.data(), kept);
+	}
+	}
+	return false;
+}
+
+// Every supported kernel matches the scalar kernel for every count from 0 to 33
+static bool DecimalKernelsMatchScalar(DecimalFilterMode _mode) {
+	std::vector<DecimalFilterKernel> kernels = SupportedDecimalKernels();
+
+	for (DecimalFilterKernel kernel : kernels)
+		for (size_t count = 0; count <= DecimalFilterMaxCount; ++count)
+			for (size_t offset = 0; offset < 8; ++offset)
+				for (float decimal : DecimalFilterDecimals)
+					if (!DecimalKernelMatchesScalar(kernel, _mode, DecimalFilterInput(offset * 5, count), decimal))
+						return false;
+	return true;
+}
+
+#pragma region Fail Tests
+FailResult UnitTests_Lab4::Fail_DecimalFilter_NaNIsRemoved() {
+	FailResult result;
+	const float nan = std::numeric_limits<float>::quiet_NaN();
+	std::vector<float> input(DecimalFilterMaxCount);
+	for (size_t i = 0; i < input.size(); ++i)
+		input[i] = i % 2 ? nan : -nan;
+
+	for (DecimalFilterKernel kernel : AllDecimalKernels())
+	{
+		std::vector<float> out(input.size());
+		if (kernel(input.data(), input.size(), 0.5f, out.data()) != input.size() ||
+			!DecimalFilterSameBits(out.data(), input.data(), input.size()))
+			result.check = true;
+	}
+	result.msg = "A kernel removed NaN values (NaN > _decimal is false, so they are kept)";
+
+	return result;
+}
+
+FailResult UnitTests_Lab4::Fail_DecimalFilter_NegativeZeroLosesSign() {
+	FailResult result;
+	std::vector<float> input(DecimalFilterMaxCount, -0.0f);
+
+	for (DecimalFilterKernel kernel : AllDecimalKernels())
+	{
+		std::vector<float> out(input.size(), 1.0f);
+		if (kernel(input.data(), input.size(), 0.0f, out.data()) != input.size() ||
+			!DecimalFilterSameBits(out.data(), input.data(), input.size()))
+			result.check = true;
+	}
+	result.msg = "A kernel did not keep -0.0 as -0.0";
+
+	return result;
+}
+
+FailResult UnitTests_Lab4::Fail_DecimalFilter_NegativesAreTruncated() {
+	FailResult result;
+	// -1.25 has a decimal place of 0.75 (it is removed), -1.75 has 0.25 (it is kept)
+	std::vector<float> input(DecimalFilterMaxCount);
+	for (size_t i = 0; i < input.size(); ++i)
+		input[i] = i % 2 ? -1.75f : -1.25f;
+
+	for (DecimalFilterKernel kernel : AllDecimalKernels())
+	{
+		std::vector<float> out(input.size());
+		size_t kept = kernel(input.data(), input.size(), 0.5f, out.data());
+		if (kept != input.size() / 2)
+			result.check = true;
+		for (size_t i = 0; i < kept && i < out.size(); ++i)
+			if (out[i] != -1.75f)
+				result.check = true;
+	}
+	result.msg = "A kernel measured the decimal place of negative values by truncating instead of flooring";
+
+	return result;
+}
+
+FailResult UnitTests_Lab4::Fail_DecimalFilter_EqualDecimalIsRemoved() {
+	FailResult result;
+	std::vector<float> input(DecimalFilterMaxCount, 2.25f);
+
+	for (DecimalFilterKernel kernel : AllDecimalKernels())
+		if (kernel(input.data(), input.size(), 0.25f, nullptr) != input.size())
+			result.check = true;
+	result.msg = "A kernel removed values whose decimal place equals _decimal (only greater ones are removed)";
+
+	return result;
+}
+
+FailResult UnitTests_Lab4::Fail_DecimalFilter_TailIsSkipped() {
+	FailResult result;
+
+	for (DecimalFilterKernel kernel : AllDecimalKernels())
+	{
+		for (size_t count = 0; count <= DecimalFilterMaxCount; ++count)
+		{
+			// Whole numbers, so every value is kept
+			std::vector<float> input(count);
+			for (size_t i = 0; i < count; ++i)
+				input[i] = (float)i;
+
+			std::vector<float> out(count);
+			if (kernel(input.data(), count, 0.5f, out.data()) != count ||
+				!DecimalFilterSameBits(out.data(), input.data(), count))
+				result.check = true;
+		}
+	}
+	result.msg = "A kernel skipped the values after its last full block";
+
+	return result;
+}
+
+FailResult UnitTests_Lab4::Fail_DecimalFilter_WritesPastCount() {
+	FailResult result;
+	const float guard = -12345.0f;
+
+	for (DecimalFilterKernel kernel : AllDecimalKernels())
+	{
+		for (size_t count = 0; count <= DecimalFilterMaxCount; ++count)
+		{
+			std::vector<float> input = DecimalFilterThirdsInput(count);
+
+			std::vector<float> out(count + 16, guard);
+			kernel(input.data(), count, 0.5f, out.data());
+			for (size_t i = count; i < out.size(); ++i)
+				if (out[i] != guard)
+					result.check = true;
+
+			std::vector<float> values = input;
+			values.resize(count + 16, guard);
+			kernel(values.data(), count, 0.5f, values.data());
+			for (size_t i = count; i < values.size(); ++i)
+				if (values[i] != guard)
+					result.check = true;
+		}
+	}
+	result.msg = "A kernel wrote past the _count values it was given";
+
+	return result;
+}
+
+FailResult UnitTests_Lab4::Fail_DecimalFilter_CountOnlyDisagreesWithCopy() {
+	FailResult result;
+
+	for (DecimalFilterKernel kernel : AllDecimalKernels())
+	{
+		for (size_t count = 0; count <= DecimalFilterMaxCount; ++count)
+		{
+			std::vector<float> input = DecimalFilterInput(count, count);
+			std::vector<float> out(count);
+			if (kernel(input.data(), count, 0.5f, nullptr) != kernel(input.data(), count, 0.5f, out.data()))
+				result.check = true;
+		}
+	}
+	result.msg = "A kernel counted a different number of kept values with a null _out than when copying";
+
+	return result;
+}
+
+FailResult UnitTests_Lab4::Fail_DecimalFilter_OutOfPlaceChangesInput() {
+	FailResult result;
+
+	for (DecimalFilterKernel kernel : AllDecimalKernels())
+	{
+		std::vector<float> input = DecimalFilterInput(0, DecimalFilterMaxCount);
+		std::vector<float> original = input;
+		std::vector<float> out(input.size());
+		kernel(input.data(), input.size(), 0.5f, out.data());
+		if (!DecimalFilterSameBits(input.data(), original.data(), input.size()))
+			result.check = true;
+	}
+	result.msg = "A kernel filtering out of place changed its input";
+
+	return result;
+}
+
+FailResult UnitTests_Lab4::Fail_DecimalFilter_InPlaceScramblesOrder() {
+	FailResult result;
+
+	for (DecimalFilterKernel kernel : AllDecimalKernels())
+	{
+		std::vector<float> values = DecimalFilterThirdsInput(DecimalFilterMaxCount);
+		size_t kept = kernel(values.data(), values.size(), 0.5f, values.data());
+
+		// Every value that is not a multiple of 3 is kept, in order
+		if (kept != DecimalFilterMaxCount - (DecimalFilterMaxCount + 2) / 3)
+			result.check = true;
+		for (size_t i = 0, expected = 1; i < kept && i < values.size(); ++i, ++expected)
+		{
+			if (expected % 3 == 0)
+				++expected;
+			if (values[i] != (float)expected)
+				result.check = true;
+		}
+	}
+	result.msg = "A kernel filtering in place lost or reordered the kept values";
+
+	return result;
+}
+
+FailResult UnitTests_Lab4::Fail_DecimalFilter_CountReturnsKept() {
+	FailResult result;
+	std::vector<float> input = DecimalFilterThirdsInput(10);	// 0, 3, 6 and 9 are removed
+
+	result.check = CountDecimalGreater(input.data(), input.size(), 0.5f) != 4;
+	result.msg = "CountDecimalGreater did not return the number of values with a decimal place > _decimal";
+
+	return result;
+}
+
+FailResult UnitTests_Lab4::Fail_DecimalFilter_CopyReturnsRemoved() {
+	FailResult result;
+	std::vector<float> input = DecimalFilterThirdsInput(10);	// 0, 3, 6 and 9 are removed
+	std::vector<float> out(input.size());
+
+	result.check = CopyWithoutDecimalGreater(input.data(), input.size(), 0.5f, out.data()) != 6;
+	result.msg = "CopyWithoutDecimalGreater did not return the number of values copied";
+
+	return result;
+}
+
+FailResult UnitTests_Lab4::Fail_DecimalFilter_RemoveReturnsKept() {
+	FailResult result;
+	std::vector<float> values = DecimalFilterThirdsInput(10);	// 0, 3, 6 and 9 are removed
+
+	result.check = RemoveDecimalGreaterInPlace(values.data(), values.size(), 0.5f) != 4;
+	result.msg = "RemoveDecimalGreaterInPlace did not return the number of values removed";
+
+	return result;
+}
+#pragma endregion
+
+#pragma region Pass Tests
+bool UnitTests_Lab4::Pass_DecimalFilter_CountOnlyIsCorrect() {
+	return DecimalKernelsMatchScalar(DecimalFilterMode::CountOnly);
+}
+
+bool UnitTests_Lab4::Pass_DecimalFilter_OutOfPlaceIsCorrect() {
+	return DecimalKernelsMatchScalar(DecimalFilterMode::OutOfPlace);
+}
+
+bool UnitTests_Lab4::Pass_DecimalFilter_InPlaceIsCorrect() {
+	return DecimalKernelsMatchScalar(DecimalFilterMode::InPlace);
+}
+
+// CountDecimalGreater, CopyWithoutDecimalGreater and RemoveDecimalGreaterInPlace
+// agree with the scalar kernel
+bool UnitTests_Lab4::Pass_DecimalFilter_PublicCallsAreCorrect() {
+	for (size_t count = 0; count <= DecimalFilterMaxCount; ++count)
+	{
+		for (float decimal : DecimalFilterDecimals)
+		{
+			std::vector<float> input = DecimalFilterInput(count, count);
+			std::vector<float> expected(count);
+			size_t kept = FilterDecimalGreaterScalar(input.data(), count, decimal, expected.data());
+
+			if (CountDecimalGreater(input.data(), count, decimal) != count - kept)
+				return false;
+
+			std::vector<float> copied(count);
+			if (CopyWithoutDecimalGreater(input.data(), count, decimal, copied.data()) != kept ||
+				!DecimalFilterSameBits(copied.data(), expected.data(), kept))
+				return false;
+
+			if (RemoveDecimalGreaterInPlace(input.data(), count, decimal) != count - kept ||
+				!DecimalFilterSameBits(input.data(), expected.data(), kept))
+				return false;
+		}
+	}
+	return true;
+}
+#pragma endregion
+#endif
+#pragma endregion
 #endif
\ No newline at end of file
@@ -16,6 +16,10 @@ Notes:			Property of Full Sail University
 /************/
 #include "UnitTestHelper.h"
 #include "..\\Lab4.h"
+#include "..\\DecimalFilter.h"
+#include "..\\IndexedSequence.h"
+#include "..\\MPMCQueue.h"
+#include "..\\RingDeque.h"
 
 class UnitTests_Lab4 {
 #if LAB_4
@@ -109,6 +113,78 @@ public:
 	static bool Pass_RemoveDecimalGreaterRandom_CorrectValueReturned();
 #pragma endregion
 
+#pragma region Test - MPMC Queues
+	static void Battery_MPMCQueues();
+
+	static FailResult Fail_MPMCQueues_BoundedCapacityIsWrong();
+	static FailResult Fail_MPMCQueues_BoundedPopOnEmptySucceeds();
+	static FailResult Fail_MPMCQueues_BoundedOrderIsWrongAfterWrap();
+	static FailResult Fail_MPMCQueues_SegmentedOrderIsWrongAcrossSegments();
+	static FailResult Fail_MPMCQueues_SegmentedKeepsDrainedSegments();
+	static FailResult Fail_MPMCQueues_SegmentedDestructorLeaksValues();
+
+	static bool Pass_MPMCQueues_BoundedEveryValuePoppedOnce();
+	static bool Pass_MPMCQueues_SegmentedEveryValuePoppedOnce();
+	static bool Pass_MPMCQueues_SegmentedMemoryIsRestored();
+#pragma endregion
+
+#pragma region Benchmark - MPMC Queues
+	static void Benchmark_MPMCQueues();
+#pragma endregion
+
+#pragma region Test - IndexedSequence
+	static void Battery_IndexedSequence();
+
+	static FailResult Fail_IndexedSequence_InsertAtEndsIsMisplaced();
+	static FailResult Fail_IndexedSequence_InsertInMiddleIsMisplaced();
+	static FailResult Fail_IndexedSequence_EraseLeavesCountsWrong();
+	static FailResult Fail_IndexedSequence_CopySharesNodes();
+	static FailResult Fail_IndexedSequence_ClearLeaksNodes();
+	static FailResult Fail_IndexedSequence_AssignmentLeaksOldNodes();
+
+	static bool Pass_IndexedSequence_ValuesMatchVector();
+	static bool Pass_IndexedSequence_CopyMatches();
+	static bool Pass_IndexedSequence_MemoryIsRestored();
+#pragma endregion
+
+#pragma region Test - RingDeque
+	static void Battery_RingDeque();
+
+	static FailResult Fail_RingDeque_QueueAddDoesNotWrap();
+	static FailResult Fail_RingDeque_StackAddDoesNotWrap();
+	static FailResult Fail_RingDeque_BatchRemoveTakesTooMany();
+	static FailResult Fail_RingDeque_GrowsAtWrongSize();
+	static FailResult Fail_RingDeque_GrowingUnwrapsWrongly();
+	static FailResult Fail_RingDeque_MoveCopiesBuffer();
+	static FailResult Fail_RingDeque_SwapKeepsBuffers();
+
+	static bool Pass_RingDeque_QueueOrderingAcrossWrapIsCorrect();
+	static bool Pass_RingDeque_StackOrderingAcrossWrapIsCorrect();
+	static bool Pass_RingDeque_GrowingWhileWrappedKeepsValues();
+	static bool Pass_RingDeque_MoveAndSwapAreCorrect();
+#pragma endregion
+
+#pragma region Test - DecimalFilter
+	static void Battery_DecimalFilter();
+
+	static FailResult Fail_DecimalFilter_NaNIsRemoved();
+	static FailResult Fail_DecimalFilter_NegativeZeroLosesSign();
+	static FailResult Fail_DecimalFilter_NegativesAreTruncated();
+	static FailResult Fail_DecimalFilter_EqualDecimalIsRemoved();
+	static FailResult Fail_DecimalFilter_TailIsSkipped();
+	static FailResult Fail_DecimalFilter_WritesPastCount();
+	static FailResult Fail_DecimalFilter_CountOnlyDisagreesWithCopy();
+	static FailResult Fail_DecimalFilter_OutOfPlaceChangesInput();
+	static FailResult Fail_DecimalFilter_InPlaceScramblesOrder();
+	static FailResult Fail_DecimalFilter_CountReturnsKept();
+	static FailResult Fail_DecimalFilter_CopyReturnsRemoved();
+	static FailResult Fail_DecimalFilter_RemoveReturnsKept();
+
+	static bool Pass_DecimalFilter_CountOnlyIsCorrect();
+	static bool Pass_DecimalFilter_OutOfPlaceIsCorrect();
+	static bool Pass_DecimalFilter_InPlaceIsCorrect();
+	static bool Pass_DecimalFilter_PublicCallsAreCorrect();
+#pragma endregion
 #endif
 
 };
\ No newline at end of file
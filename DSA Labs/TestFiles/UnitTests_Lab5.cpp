@@ -72,6 +72,15 @@ void UnitTests_Lab5::FullBattery() {
 #if LAB5_COPY_CTOR
 	Battery_CopyConstructor();
 #endif
+#if LAB5_MOVE_SEMANTICS
+	Battery_MoveSemantics();
+#endif
+#if LAB5_REHASH
+	Battery_Rehash();
+#endif
+#if LAB5_FLAT_DICTIONARY
+	Battery_FlatDictionary();
+#endif
 }
 
 unsigned int UnitTests_Lab5::Hash(const float& _f) {
@@ -1695,4 +1704,1060 @@ bool UnitTests_Lab5::Pass_Copy_Constructor_HashFuncIsCorrectValue() {
 #pragma endregion
 #endif
 #pragma endregion
+
+#pragma region Test - Move Semantics
+#if LAB5_MOVE_SEMANTICS
+void UnitTests_Lab5::Battery_MoveSemantics() {
+	FailVector failVec;
+	failVec.push_back(Fail_MoveSemantics_MemoryIsAllocated);
+	failVec.push_back(Fail_MoveSemantics_TableIsNotTransferred);
+	failVec.push_back(Fail_MoveSemantics_ArgumentIsNotEmpty);
+	failVec.push_back(Fail_MoveSemantics_ArgumentIsNotUsable);
+
+	PassVector passVec;
+	passVec.push_back(Pass_MoveSemantics_NoMemoryAllocated);
+	passVec.push_back(Pass_MoveSemantics_TableIsTransferred);
+	passVec.push_back(Pass_MoveSemantics_ArgumentIsEmpty);
+	passVec.push_back(Pass_MoveSemantics_ArgumentIsUsable);
+
+	UnitTestBattery("Testing move constructor and move assignment", failVec, passVec);
+}
+
+#pragma region Fail Tests
+FailResult UnitTests_Lab5::Fail_MoveSemantics_MemoryIsAllocated() {
+	DictionaryWithValues dict = CreateDictionary();
+	Dict assignTo(0, Hash);
+
+	int64_t memoryDeltaStart = (int64_t)inUse;
+	Dict moveTo = std::move(*dict.dict);
+	assignTo = std::move(moveTo);
+	int64_t memoryDeltaEnd = (int64_t)inUse;
+
+	FailResult result;
+	result.check = memoryDeltaEnd > memoryDeltaStart;
+	result.msg = "Memory was allocated while moving";
+
+	dict.CleanUp();
+	return result;
+}
+
+FailResult UnitTests_Lab5::Fail_MoveSemantics_TableIsNotTransferred() {
+	DictionaryWithValues dict = CreateDictionary();
+	pairList* table = dict.dict->mTable;
+	Dict assignTo(0, Hash);
+
+	Dict moveTo = std::move(*dict.dict);
+	assignTo = std::move(moveTo);
+
+	FailResult result;
+	result.check = assignTo.mTable != table || assignTo.mNumBuckets != dict.size || assignTo.mHashFunc != Hash;
+	result.msg = "Table was not handed over to the invoking object";
+
+	dict.CleanUp();
+	return result;
+}
+
+FailResult UnitTests_Lab5::Fail_MoveSemantics_ArgumentIsNotEmpty() {
+	DictionaryWithValues dict = CreateDictionary();
+	Dict assignTo(0, Hash);
+
+	Dict moveTo = std::move(*dict.dict);
+	assignTo = std::move(moveTo);
+
+	FailResult result;
+	result.check = dict.dict->mTable != nullptr || dict.dict->mNumBuckets != 0 ||
+		moveTo.mTable != nullptr || moveTo.mNumBuckets != 0;
+	result.msg = "Moved-from object still holds the table";
+
+	// Preventing crash
+	if (result.check) {
+		dict.dict->mTable = moveTo.mTable = nullptr;
+		dict.dict->mNumBuckets = moveTo.mNumBuckets = 0;
+	}
+
+	dict.CleanUp();
+	return result;
+}
+
+FailResult UnitTests_Lab5::Fail_MoveSemantics_ArgumentIsNotUsable() {
+	DictionaryWithValues dict = CreateDictionary();
+	Dict assignTo(0, Hash);
+	float key = dict.values[0];
+
+	Dict moveTo = std::move(*dict.dict);
+	assignTo = std::move(moveTo);
+
+	// Both moved-from objects should act like empty dictionaries
+	bool emptyFind = dict.dict->Find(key) == nullptr && moveTo.Find(key) == nullptr;
+	bool emptyRemove = !dict.dict->Remove(key) && !moveTo.Remove(key);
+
+	dict.dict->Insert(key, 1.0f);
+	moveTo.Insert(key, 2.0f);
+	const float* found = dict.dict->Find(key);
+	const float* foundMoveTo = moveTo.Find(key);
+
+	FailResult result;
+	result.check = !emptyFind || !emptyRemove ||
+		found == nullptr || *found != 1.0f || foundMoveTo == nullptr || *foundMoveTo != 2.0f ||
+		!dict.dict->Remove(key) || !moveTo.Remove(key);
+	result.msg = "Moved-from object can not be used again";
+
+	dict.CleanUp();
+	return result;
+}
+#pragma endregion
+
+#pragma region Pass Tests
+bool UnitTests_Lab5::Pass_MoveSemantics_NoMemoryAllocated() {
+	DictionaryWithValues dict = CreateDictionary();
+	Dict assignTo(0, Hash);
+
+	int64_t memoryDeltaStart = (int64_t)inUse;
+	Dict moveTo = std::move(*dict.dict);
+	assignTo = std::move(moveTo);
+	int64_t memoryDeltaEnd = (int64_t)inUse;
+
+	bool result = memoryDeltaEnd <= memoryDeltaStart;
+
+	dict.CleanUp();
+	return result;
+}
+
+bool UnitTests_Lab5::Pass_MoveSemantics_TableIsTransferred() {
+	DictionaryWithValues dict = CreateDictionary();
+	pairList* table = dict.dict->mTable;
+	Dict assignTo(0, Hash);
+
+	Dict moveTo = std::move(*dict.dict);
+	assignTo = std::move(moveTo);
+
+	bool result = assignTo.mTable == table && assignTo.mNumBuckets == dict.size && assignTo.mHashFunc == Hash;
+
+	dict.CleanUp();
+	return result;
+}
+
+bool UnitTests_Lab5::Pass_MoveSemantics_ArgumentIsEmpty() {
+	DictionaryWithValues dict = CreateDictionary();
+	Dict assignTo(0, Hash);
+
+	Dict moveTo = std::move(*dict.dict);
+	assignTo = std::move(moveTo);
+
+	bool result = dict.dict->mTable == nullptr && dict.dict->mNumBuckets == 0 &&
+		moveTo.mTable == nullptr && moveTo.mNumBuckets == 0;
+
+	dict.CleanUp();
+	return result;
+}
+
+bool UnitTests_Lab5::Pass_MoveSemantics_ArgumentIsUsable() {
+	DictionaryWithValues dict = CreateDictionary();
+	Dict assignTo(0, Hash);
+	float key = dict.values[0];
+
+	Dict moveTo = std::move(*dict.dict);
+	assignTo = std::move(moveTo);
+
+	bool result = dict.dict->Find(key) == nullptr && !dict.dict->Remove(key) &&
+		moveTo.Find(key) == nullptr && !moveTo.Remove(key);
+
+	dict.dict->Insert(key, 1.0f);
+	moveTo.Insert(key, 2.0f);
+	const float* found = dict.dict->Find(key);
+	const float* foundMoveTo = moveTo.Find(key);
+
+	result = result && found != nullptr && *found == 1.0f && foundMoveTo != nullptr && *foundMoveTo == 2.0f &&
+		dict.dict->Remove(key) && moveTo.Remove(key) && dict.dict->Find(key) == nullptr;
+
+	dict.CleanUp();
+	return result;
+}
+#pragma endregion
+#endif
+#pragma endregion
+
+#pragma region Test - Rehash
+#if LAB5_REHASH
+void UnitTests_Lab5::Battery_Rehash() {
+	FailVector failVec;
+	failVec.push_back(Fail_Rehash_OverwriteChangesSize);
+	failVec.push_back(Fail_Rehash_RemoveDoesNotUpdateSize);
+	failVec.push_back(Fail_Rehash_GrowsBeforeLimit);
+	failVec.push_back(Fail_Rehash_BucketsDoNotDouble);
+	failVec.push_back(Fail_Rehash_LowLoadFactorIsNotClamped);
+	failVec.push_back(Fail_Rehash_HighLoadFactorIsNotClamped);
+	failVec.push_back(Fail_Rehash_NegativeLoadFactorGrows);
+	failVec.push_back(Fail_Rehash_EmptyTableDoesNotGrow);
+	failVec.push_back(Fail_Rehash_FullRehashLosesKeys);
+	failVec.push_back(Fail_Rehash_IncrementalRehashLosesKeys);
+	failVec.push_back(Fail_Rehash_RemoveMissesUnmovedKey);
+	failVec.push_back(Fail_Rehash_IncrementalRehashNeverFinishes);
+	failVec.push_back(Fail_Rehash_CopyDuringRehashLosesKeys);
+	failVec.push_back(Fail_Rehash_SwapDuringRehashLosesKeys);
+	failVec.push_back(Fail_Rehash_MoveDuringRehashLosesKeys);
+	failVec.push_back(Fail_Rehash_OldTableLeaks);
+	failVec.push_back(Fail_Rehash_DestructorLeaksOldTable);
+
+	PassVector passVec;
+	passVec.push_back(Pass_Rehash_SizeIsCorrect);
+	passVec.push_back(Pass_Rehash_BucketsDouble);
+	passVec.push_back(Pass_Rehash_LoadFactorIsClamped);
+	passVec.push_back(Pass_Rehash_KeysAreFound);
+	passVec.push_back(Pass_Rehash_CopyOrSwapDuringRehashKeepsKeys);
+	passVec.push_back(Pass_Rehash_MemoryIsRestored);
+
+	UnitTestBattery("Testing load factor growth and rehashing", failVec, passVec);
+}
+
+// Full hash of the key (Hash only returns bucket numbers, so a bigger table would not spread them)
+static unsigned int RehashHash(const float& _f) {
+	return static_cast<unsigned int>(std::hash<float>()(_f));
+}
+
+// Adds the keys [_first, _first + _count) with a value of twice the key
+static void RehashInsertKeys(UnitTests_Lab5::Dict& _dict, int _first, int _count) {
+	for (int i = _first; i < _first + _count; ++i)
+		_dict.Insert((float)i, (float)i * 2);
+}
+
+// Checks that the keys [_first, _first + _count) are all found with a value of twice the key
+static bool RehashKeysFound(UnitTests_Lab5::Dict& _dict, int _first, int _count) {
+	for (int i = _first; i < _first + _count; ++i) {
+		const float* value = _dict.Find((float)i);
+		if (value == nullptr || *value != (float)i * 2)
+			return false;
+	}
+	return true;
+}
+
+// Nine pairs in eight buckets starts an incremental rehash that has not moved anything yet
+static void RehashStartIncremental(UnitTests_Lab5::Dict& _dict) {
+	_dict.SetMaxLoadFactor(1.0f);
+	_dict.SetIncrementalRehash(true);
+	RehashInsertKeys(_dict, 0, 9);
+}
+
+#pragma region Fail Tests
+FailResult UnitTests_Lab5::Fail_Rehash_OverwriteChangesSize() {
+	Dict dict(11, RehashHash);
+	dict.SetMaxLoadFactor(1.0f);
+	RehashInsertKeys(dict, 0, 200);
+	RehashInsertKeys(dict, 0, 50);
+
+	FailResult result;
+	result.check = dict.Size() != 200;
+	result.msg = "Overwriting existing keys changed the size";
+
+	return result;
+}
+
+FailResult UnitTests_Lab5::Fail_Rehash_RemoveDoesNotUpdateSize() {
+	Dict dict(11, RehashHash);
+	dict.SetMaxLoadFactor(1.0f);
+	RehashInsertKeys(dict, 0, 200);
+	for (int i = 0; i < 60; ++i)
+		dict.Remove((float)i);
+	dict.Remove(1000.0f);
+
+	FailResult result;
+	result.check = dict.Size() != 140;
+	result.msg = "Size is incorrect after removing existing and missing keys";
+
+	return result;
+}
+
+FailResult UnitTests_Lab5::Fail_Rehash_GrowsBeforeLimit() {
+	Dict dict(8, RehashHash);
+	dict.SetMaxLoadFactor(1.0f);
+	RehashInsertKeys(dict, 0, 8);
+
+	FailResult result;
+	result.check = dict.mNumBuckets != 8;
+	result.msg = "Table grew while the load factor was still at the max";
+
+	return result;
+}
+
+FailResult UnitTests_Lab5::Fail_Rehash_BucketsDoNotDouble() {
+	Dict dict(8, RehashHash);
+	dict.SetMaxLoadFactor(1.0f);
+	RehashInsertKeys(dict, 0, 9);
+
+	FailResult result;
+	result.check = dict.mNumBuckets != 16;
+	result.msg = "Bucket count did not double once the max load factor was passed";
+
+	return result;
+}
+
+FailResult UnitTests_Lab5::Fail_Rehash_LowLoadFactorIsNotClamped() {
+	Dict dict(8, RehashHash);
+	RehashInsertKeys(dict, 0, 9);
+	dict.SetMaxLoadFactor(1e-30f);
+
+	// Clamped to 0.25, so 9 pairs need 64 buckets
+	FailResult result;
+	result.check = dict.mMaxLoadFactor != 0.25f || dict.mNumBuckets != 64;
+	result.msg = "A tiny max load factor was not clamped to 0.25";
+
+	return result;
+}
+
+FailResult UnitTests_Lab5::Fail_Rehash_HighLoadFactorIsNotClamped() {
+	Dict dict(8, RehashHash);
+	dict.SetMaxLoadFactor(1e30f);
+
+	FailResult result;
+	result.check = dict.mMaxLoadFactor != 8.0f;
+	result.msg = "A huge max load factor was not clamped to 8";
+
+	return result;
+}
+
+FailResult UnitTests_Lab5::Fail_Rehash_NegativeLoadFactorGrows() {
+	Dict dict(8, RehashHash);
+	dict.SetMaxLoadFactor(-1.0f);
+	RehashInsertKeys(dict, 0, 100);
+
+	FailResult result;
+	result.check = dict.mMaxLoadFactor != 0.0f || dict.mNumBuckets != 8;
+	result.msg = "A max load factor of 0 or less did not turn growing off";
+
+	return result;
+}
+
+FailResult UnitTests_Lab5::Fail_Rehash_EmptyTableDoesNotGrow() {
+	Dict dict(0, RehashHash);
+	dict.SetMaxLoadFactor(1.0f);
+	RehashInsertKeys(dict, 0, 100);
+
+	FailResult result;
+	result.check = dict.mNumBuckets < 100 || !RehashKeysFound(dict, 0, 100);
+	result.msg = "A table that started with no buckets did not grow";
+
+	return result;
+}
+
+FailResult UnitTests_Lab5::Fail_Rehash_FullRehashLosesKeys() {
+	Dict dict(8, RehashHash);
+	dict.SetMaxLoadFactor(1.0f);
+	RehashInsertKeys(dict, 0, 1000);
+
+	FailResult result;
+	result.check = dict.Size() != 1000 || !RehashKeysFound(dict, 0, 1000);
+	result.msg = "Keys were lost by a full rehash";
+
+	return result;
+}
+
+FailResult UnitTests_Lab5::Fail_Rehash_IncrementalRehashLosesKeys() {
+	Dict dict(8, RehashHash);
+	dict.SetMaxLoadFactor(1.0f);
+	dict.SetIncrementalRehash(true);
+	RehashInsertKeys(dict, 0, 1000);
+
+	FailResult result;
+	result.check = dict.Size() != 1000 || !RehashKeysFound(dict, 0, 1000);
+	result.msg = "Keys were lost by an incremental rehash";
+
+	return result;
+}
+
+FailResult UnitTests_Lab5::Fail_Rehash_RemoveMissesUnmovedKey() {
+	Dict dict(8, RehashHash);
+	RehashStartIncremental(dict);
+
+	// A key in an old bucket the first step does not reach
+	float key = 0.0f;
+	for (int i = 0; i < 9; ++i)
+	{
+		if (RehashHash((float)i) % 8 >= Dict::mRehashStep)
+		{
+			key = (float)i;
+			break;
+		}
+	}
+	bool removed = dict.Remove(key);
+
+	FailResult result;
+	result.check = !removed || dict.Find(key) != nullptr || dict.Size() != 8;
+	result.msg = "Remove did not move the key's old bucket over before looking for it";
+
+	return result;
+}
+
+FailResult UnitTests_Lab5::Fail_Rehash_IncrementalRehashNeverFinishes() {
+	Dict dict(8, RehashHash);
+	RehashStartIncremental(dict);
+	for (int i = 0; i < 4; ++i)
+		dict.Find((float)i);
+
+	FailResult result;
+	result.check = dict.mOldTable != nullptr || !RehashKeysFound(dict, 0, 9);
+	result.msg = "The old table was still in use after every old bucket was moved";
+
+	return result;
+}
+
+FailResult UnitTests_Lab5::Fail_Rehash_CopyDuringRehashLosesKeys() {
+	Dict dict(8, RehashHash);
+	RehashStartIncremental(dict);
+
+	Dict copy(dict);
+	Dict assigned(5, RehashHash);
+	RehashInsertKeys(assigned, 500, 1);
+	assigned = dict;
+
+	FailResult result;
+	result.check = !RehashKeysFound(copy, 0, 9) || copy.Size() != 9 ||
+		!RehashKeysFound(assigned, 0, 9) || assigned.Size() != 9 || assigned.Find(500.0f) != nullptr;
+	result.msg = "Copying during an incremental rehash lost the pairs still in the old table";
+
+	return result;
+}
+
+FailResult UnitTests_Lab5::Fail_Rehash_SwapDuringRehashLosesKeys() {
+	Dict dict(8, RehashHash);
+	RehashStartIncremental(dict);
+
+	Dict swapped(8, RehashHash);
+	RehashInsertKeys(swapped, 700, 1);
+	swapped.Swap(dict);
+
+	FailResult result;
+	result.check = !RehashKeysFound(swapped, 0, 9) || swapped.Size() != 9 ||
+		!RehashKeysFound(dict, 700, 1) || dict.Size() != 1 || dict.Find(0.0f) != nullptr;
+	result.msg = "Swapping during an incremental rehash lost keys";
+
+	return result;
+}
+
+FailResult UnitTests_Lab5::Fail_Rehash_MoveDuringRehashLosesKeys() {
+	Dict dict(8, RehashHash);
+	RehashStartIncremental(dict);
+
+	Dict moveTo(std::move(dict));
+	Dict assignTo(8, RehashHash);
+	assignTo = std::move(moveTo);
+
+	FailResult result;
+	result.check = !RehashKeysFound(assignTo, 0, 9) || assignTo.Size() != 9 ||
+		dict.mOldTable != nullptr || dict.Size() != 0 || moveTo.mOldTable != nullptr || moveTo.Size() != 0;
+	result.msg = "Moving during an incremental rehash lost keys, or left the old table behind";
+
+	// Preventing crash
+	if (dict.mOldTable != nullptr || moveTo.mOldTable != nullptr) {
+		dict.mOldTable = moveTo.mOldTable = nullptr;
+		dict.mOldNumBuckets = moveTo.mOldNumBuckets = 0;
+		dict.mRehashIndex = moveTo.mRehashIndex = 0;
+	}
+
+	return result;
+}
+
+FailResult UnitTests_Lab5::Fail_Rehash_OldTableLeaks() {
+	int64_t memoryDeltaStart = (int64_t)inUse;
+	{
+		Dict dict(8, RehashHash);
+		dict.SetMaxLoadFactor(1.0f);
+		RehashInsertKeys(dict, 0, 1000);
+	}
+	int64_t memoryDeltaEnd = (int64_t)inUse;
+
+	FailResult result;
+	result.check = memoryDeltaEnd != memoryDeltaStart;
+	result.msg = "The old table was not freed after growing";
+
+	return result;
+}
+
+FailResult UnitTests_Lab5::Fail_Rehash_DestructorLeaksOldTable() {
+	int64_t memoryDeltaStart = (int64_t)inUse;
+	{
+		// Destroyed while still rehashing
+		Dict dict(8, RehashHash);
+		RehashStartIncremental(dict);
+	}
+	int64_t memoryDeltaEnd = (int64_t)inUse;
+
+	FailResult result;
+	result.check = memoryDeltaEnd != memoryDeltaStart;
+	result.msg = "Memory was not freed by a dictionary destroyed during an incremental rehash";
+
+	return result;
+}
+#pragma endregion
+
+#pragma region Pass Tests
+// Size after inserts, overwrites and removes (growing along the way)
+bool UnitTests_Lab5::Pass_Rehash_SizeIsCorrect() {
+	Dict dict(11, RehashHash);
+	dict.SetMaxLoadFactor(1.0f);
+
+	RehashInsertKeys(dict, 0, 200);
+	bool result = dict.Size() == 200;
+
+	RehashInsertKeys(dict, 0, 50);
+	result = result && dict.Size() == 200;
+
+	for (int i = 0; i < 60; ++i)
+		dict.Remove((float)i);
+	dict.Remove(1000.0f);
+	result = result && dict.Size() == 140;
+
+	dict.Clear();
+	return result && dict.Size() == 0;
+}
+
+bool UnitTests_Lab5::Pass_Rehash_BucketsDouble() {
+	Dict dict(8, RehashHash);
+	dict.SetMaxLoadFactor(1.0f);
+
+	RehashInsertKeys(dict, 0, 8);
+	size_t bucketsAtLimit = dict.mNumBuckets;
+	RehashInsertKeys(dict, 8, 1);
+
+	bool result = bucketsAtLimit == 8 && dict.mNumBuckets == 16 && RehashKeysFound(dict, 0, 9);
+
+	return result;
+}
+
+bool UnitTests_Lab5::Pass_Rehash_LoadFactorIsClamped() {
+	Dict tiny(8, RehashHash);
+	RehashInsertKeys(tiny, 0, 9);
+	tiny.SetMaxLoadFactor(1e-30f);
+
+	Dict huge(8, RehashHash);
+	huge.SetMaxLoadFactor(1e30f);
+
+	Dict off(8, RehashHash);
+	off.SetMaxLoadFactor(-1.0f);
+	RehashInsertKeys(off, 0, 100);
+
+	Dict noBuckets(0, RehashHash);
+	noBuckets.SetMaxLoadFactor(1.0f);
+	RehashInsertKeys(noBuckets, 0, 100);
+
+	bool result = tiny.mMaxLoadFactor == 0.25f && tiny.mNumBuckets == 64 && RehashKeysFound(tiny, 0, 9) &&
+		huge.mMaxLoadFactor == 8.0f &&
+		off.mMaxLoadFactor == 0.0f && off.mNumBuckets == 8 &&
+		noBuckets.mNumBuckets >= 100 && RehashKeysFound(noBuckets, 0, 100);
+
+	return result;
+}
+
+// Checks keys survive a full rehash and an incremental one (including removes while it is going)
+bool UnitTests_Lab5::Pass_Rehash_KeysAreFound() {
+	Dict full(8, RehashHash);
+	full.SetMaxLoadFactor(1.0f);
+	RehashInsertKeys(full, 0, 1000);
+
+	Dict incremental(8, RehashHash);
+	incremental.SetMaxLoadFactor(1.0f);
+	incremental.SetIncrementalRehash(true);
+	RehashInsertKeys(incremental, 0, 1000);
+	for (int i = 0; i < 1000; i += 2)
+		incremental.Remove((float)i);
+
+	bool result = RehashKeysFound(full, 0, 1000) && full.Size() == 1000 && incremental.Size() == 500;
+	for (int i = 0; i < 1000 && result; ++i)
+		result = (incremental.Find((float)i) != nullptr) == (i % 2 == 1);
+
+	return result;
+}
+
+bool UnitTests_Lab5::Pass_Rehash_CopyOrSwapDuringRehashKeepsKeys() {
+	// Nine pairs in eight buckets starts an incremental rehash that has not moved anything yet
+	Dict dict(8, RehashHash);
+	dict.SetMaxLoadFactor(1.0f);
+	dict.SetIncrementalRehash(true);
+	RehashInsertKeys(dict, 0, 9);
+	bool rehashing = dict.mOldTable != nullptr;
+
+	Dict copy(dict);
+	Dict assigned(5, RehashHash);
+	RehashInsertKeys(assigned, 500, 1);
+	assigned = dict;
+
+	Dict swapped(8, RehashHash);
+	RehashInsertKeys(swapped, 700, 1);
+	swapped.Swap(dict);
+
+	bool result = rehashing &&
+		RehashKeysFound(copy, 0, 9) && copy.Size() == 9 &&
+		RehashKeysFound(assigned, 0, 9) && assigned.Size() == 9 && assigned.Find(500.0f) == nullptr &&
+		RehashKeysFound(swapped, 0, 9) && swapped.Size() == 9 &&
+		RehashKeysFound(dict, 700, 1) && dict.Size() == 1 && dict.Find(0.0f) == nullptr;
+
+	return result;
+}
+
+bool UnitTests_Lab5::Pass_Rehash_MemoryIsRestored() {
+	int64_t memoryDeltaStart = (int64_t)inUse;
+	{
+		Dict grown(8, RehashHash);
+		grown.SetMaxLoadFactor(1.0f);
+		grown.SetIncrementalRehash(true);
+		RehashInsertKeys(grown, 0, 1000);
+		Dict copy(grown);
+
+		// Destroyed while still rehashing
+		Dict rehashing(8, RehashHash);
+		rehashing.SetMaxLoadFactor(1.0f);
+		rehashing.SetIncrementalRehash(true);
+		RehashInsertKeys(rehashing, 0, 9);
+	}
+	int64_t memoryDeltaEnd = (int64_t)inUse;
+
+	bool result = memoryDeltaEnd == memoryDeltaStart;
+
+	return result;
+}
+#pragma endregion
+#endif
+#pragma endregion
+
+#pragma region Test - FlatDictionary
+#if LAB5_FLAT_DICTIONARY
+void UnitTests_Lab5::Battery_FlatDictionary() {
+	FailVector failVec;
+	failVec.push_back(Fail_FlatDictionary_OverwriteAddsPair);
+	failVec.push_back(Fail_FlatDictionary_OverwriteKeepsOldValue);
+	failVec.push_back(Fail_FlatDictionary_MissingKeyIsFound);
+	failVec.push_back(Fail_FlatDictionary_GrowingLosesKeys);
+	failVec.push_back(Fail_FlatDictionary_RemoveLeavesKey);
+	failVec.push_back(Fail_FlatDictionary_RemoveMissingKeySucceeds);
+	failVec.push_back(Fail_FlatDictionary_RemoveInProbeRunLosesKeys);
+	failVec.push_back(Fail_FlatDictionary_ClearLeavesPairs);
+	failVec.push_back(Fail_FlatDictionary_ClearShrinksTable);
+	failVec.push_back(Fail_FlatDictionary_ReserveIsWrongSize);
+	failVec.push_back(Fail_FlatDictionary_LowLoadFactorIsNotClamped);
+	failVec.push_back(Fail_FlatDictionary_HighLoadFactorIsNotClamped);
+	failVec.push_back(Fail_FlatDictionary_MovedFromObjectIsNotEmpty);
+	failVec.push_back(Fail_FlatDictionary_MovedFromObjectIsNotUsable);
+	failVec.push_back(Fail_FlatDictionary_MoveAssignmentKeepsOldPairs);
+	failVec.push_back(Fail_FlatDictionary_RemoveLeaksValues);
+	failVec.push_back(Fail_FlatDictionary_GrowingLeaksOldTable);
+	failVec.push_back(Fail_FlatDictionary_AssignmentLeaksOldValues);
+	failVec.push_back(Fail_FlatDictionary_DestructorLeaksValues);
+
+	PassVector passVec;
+	passVec.push_back(Pass_FlatDictionary_InsertAndFindAreCorrect);
+	passVec.push_back(Pass_FlatDictionary_RemoveAndClearAreCorrect);
+	passVec.push_back(Pass_FlatDictionary_RemoveInProbeRunKeepsKeys);
+	passVec.push_back(Pass_FlatDictionary_GrowthIsCorrect);
+	passVec.push_back(Pass_FlatDictionary_MovedFromObjectIsUsable);
+	passVec.push_back(Pass_FlatDictionary_MemoryIsRestored);
+
+	UnitTestBattery("Testing FlatDictionary", failVec, passVec);
+}
+
+// Sends every key to the same slot, so every pair lands in one probe run
+struct FlatCollidingHash {
+	size_t operator()(const float&) const {
+		return 0;
+	}
+};
+
+// Adds the keys [_first, _first + _count) with a value of twice the key
+template<typename Hash>
+static void FlatInsertKeys(FlatDictionary<float, float, Hash>& _dict, int _first, int _count) {
+	for (int i = _first; i < _first + _count; ++i)
+		_dict.Insert((float)i, (float)i * 2);
+}
+
+// Checks that the keys [_first, _first + _count) are all found with a value of twice the key
+template<typename Hash>
+static bool FlatKeysFound(const FlatDictionary<float, float, Hash>& _dict, int _first, int _count) {
+	for (int i = _first; i < _first + _count; ++i) {
+		const float* value = _dict.Find((float)i);
+		if (value == nullptr || *value != (float)i * 2)
+			return false;
+	}
+	return true;
+}
+
+// Adds the keys [_first, _first + _count), each with a vector that owns memory
+static void FlatInsertVectors(UnitTests_Lab5::FlatVectorDict& _dict, int _first, int _count) {
+	for (int i = _first; i < _first + _count; ++i)
+		_dict.Insert(i, std::vector<int>(8, i));
+}
+
+#pragma region Fail Tests
+FailResult UnitTests_Lab5::Fail_FlatDictionary_OverwriteAddsPair() {
+	FlatDict dict(8);
+	FlatInsertKeys(dict, 0, 10);
+	dict.Insert(5.0f, -1.0f);
+
+	FailResult result;
+	result.check = dict.Size() != 10;
+	result.msg = "Inserting an existing key added another pair";
+
+	return result;
+}
+
+FailResult UnitTests_Lab5::Fail_FlatDictionary_OverwriteKeepsOldValue() {
+	FlatDict dict(8);
+	FlatInsertKeys(dict, 0, 10);
+	dict.Insert(5.0f, -1.0f);
+	const float* value = dict.Find(5.0f);
+
+	FailResult result;
+	result.check = value == nullptr || *value != -1.0f;
+	result.msg = "Inserting an existing key did not overwrite its value";
+
+	return result;
+}
+
+FailResult UnitTests_Lab5::Fail_FlatDictionary_MissingKeyIsFound() {
+	FlatDictionary<float, float, FlatCollidingHash> dict(16);
+	FlatInsertKeys(dict, 0, 8);
+
+	FailResult result;
+	result.check = dict.Find(8.0f) != nullptr || dict.Find(-1.0f) != nullptr;
+	result.msg = "Find returned a value for a key that was never inserted";
+
+	return result;
+}
+
+FailResult UnitTests_Lab5::Fail_FlatDictionary_GrowingLosesKeys() {
+	FlatDict dict(2);
+	FlatInsertKeys(dict, 0, 100);
+
+	FailResult result;
+	result.check = dict.Size() != 100 || !FlatKeysFound(dict, 0, 100);
+	result.msg = "Keys were lost when the table doubled";
+
+	return result;
+}
+
+FailResult UnitTests_Lab5::Fail_FlatDictionary_RemoveLeavesKey() {
+	FlatDict dict(8);
+	FlatInsertKeys(dict, 0, 10);
+	bool removed = dict.Remove(4.0f);
+
+	FailResult result;
+	result.check = !removed || dict.Find(4.0f) != nullptr || dict.Size() != 9;
+	result.msg = "Remove did not take the key out";
+
+	return result;
+}
+
+FailResult UnitTests_Lab5::Fail_FlatDictionary_RemoveMissingKeySucceeds() {
+	FlatDict dict(8);
+	FlatInsertKeys(dict, 0, 10);
+	bool removed = dict.Remove(1000.0f);
+
+	FailResult result;
+	result.check = removed || dict.Size() != 10 || !FlatKeysFound(dict, 0, 10);
+	result.msg = "Removing a key that is not present returned true or changed the table";
+
+	return result;
+}
+
+FailResult UnitTests_Lab5::Fail_FlatDictionary_RemoveInProbeRunLosesKeys() {
+	FlatDictionary<float, float, FlatCollidingHash> dict(16);
+	FlatInsertKeys(dict, 0, 8);
+	dict.Remove(3.0f);
+
+	FailResult result;
+	result.check = !FlatKeysFound(dict, 0, 3) || !FlatKeysFound(dict, 4, 4);
+	result.msg = "Removing from the middle of a probe run lost the keys after it";
+
+	return result;
+}
+
+FailResult UnitTests_Lab5::Fail_FlatDictionary_ClearLeavesPairs() {
+	FlatDict dict(8);
+	FlatInsertKeys(dict, 0, 10);
+	dict.Clear();
+	bool emptied = dict.Size() == 0 && dict.Find(1.0f) == nullptr;
+
+	// The cleared slots must be free for new pairs, and the old keys must stay gone
+	FlatInsertKeys(dict, 20, 1);
+
+	FailResult result;
+	result.check = !emptied || dict.Size() != 1 || !FlatKeysFound(dict, 20, 1) || dict.Find(1.0f) != nullptr;
+	result.msg = "Clear left pairs in the table";
+
+	return result;
+}
+
+FailResult UnitTests_Lab5::Fail_FlatDictionary_ClearShrinksTable() {
+	FlatDict dict(8);
+	FlatInsertKeys(dict, 0, 100);
+	size_t buckets = dict.BucketCount();
+	dict.Clear();
+
+	FailResult result;
+	result.check = dict.BucketCount() != buckets;
+	result.msg = "Clear changed the number of slots";
+
+	return result;
+}
+
+FailResult UnitTests_Lab5::Fail_FlatDictionary_ReserveIsWrongSize() {
+	FlatDict dict(2);
+	dict.Reserve(100);
+
+	FailResult result;
+	result.check = dict.BucketCount() != 128;
+	result.msg = "Reserve did not grow to the smallest power of 2 that fits under the max load factor";
+
+	return result;
+}
+
+FailResult UnitTests_Lab5::Fail_FlatDictionary_LowLoadFactorIsNotClamped() {
+	FlatDict dict(2);
+	FlatInsertKeys(dict, 0, 100);
+	dict.SetMaxLoadFactor(0.01f);
+
+	// Clamped to 0.25, so 100 pairs need 512 slots
+	FailResult result;
+	result.check = dict.BucketCount() != 512;
+	result.msg = "SetMaxLoadFactor did not clamp a low load factor to 0.25";
+
+	return result;
+}
+
+FailResult UnitTests_Lab5::Fail_FlatDictionary_HighLoadFactorIsNotClamped() {
+	FlatDict dict(64);
+	dict.SetMaxLoadFactor(2.0f);
+	FlatInsertKeys(dict, 0, 64);
+
+	// Clamped to 0.95, so the table never gets completely full
+	FailResult result;
+	result.check = dict.LoadFactor() > 0.95f || dict.Size() != 64;
+	result.msg = "SetMaxLoadFactor did not clamp a high load factor to 0.95";
+
+	return result;
+}
+
+FailResult UnitTests_Lab5::Fail_FlatDictionary_MovedFromObjectIsNotEmpty() {
+	FlatDict dict;
+	FlatInsertKeys(dict, 0, 20);
+	FlatDict moveTo(std::move(dict));
+	FlatDict assignTo;
+	FlatInsertKeys(assignTo, 100, 5);
+	assignTo = std::move(moveTo);
+
+	FailResult result;
+	result.check = dict.Size() != 0 || dict.Find(0.0f) != nullptr || dict.Remove(0.0f) ||
+		moveTo.Size() != 0 || moveTo.Find(0.0f) != nullptr || moveTo.Remove(0.0f) || moveTo.Find(100.0f) != nullptr;
+	result.msg = "Moved-from object still holds pairs";
+
+	return result;
+}
+
+FailResult UnitTests_Lab5::Fail_FlatDictionary_MovedFromObjectIsNotUsable() {
+	FlatDict dict;
+	FlatInsertKeys(dict, 0, 20);
+	FlatDict moveTo(std::move(dict));
+
+	FlatInsertKeys(dict, 0, 20);
+
+	FailResult result;
+	result.check = dict.Size() != 20 || !FlatKeysFound(dict, 0, 20);
+	result.msg = "Moved-from object can not be used again";
+
+	return result;
+}
+
+FailResult UnitTests_Lab5::Fail_FlatDictionary_MoveAssignmentKeepsOldPairs() {
+	FlatDict dict;
+	FlatInsertKeys(dict, 0, 20);
+	FlatDict assignTo;
+	FlatInsertKeys(assignTo, 100, 5);
+	assignTo = std::move(dict);
+
+	FailResult result;
+	result.check = assignTo.Size() != 20 || !FlatKeysFound(assignTo, 0, 20) || assignTo.Find(100.0f) != nullptr;
+	result.msg = "Move assignment did not replace the old pairs";
+
+	return result;
+}
+
+FailResult UnitTests_Lab5::Fail_FlatDictionary_RemoveLeaksValues() {
+	FlatVectorDict dict(16);
+	size_t memoryStart = inUse;
+	FlatInsertVectors(dict, 0, 10);
+	for (int i = 0; i < 10; ++i)
+		dict.Remove(i);
+
+	FailResult result;
+	result.check = inUse != memoryStart;
+	result.msg = "Remove did not free the removed value";
+
+	return result;
+}
+
+FailResult UnitTests_Lab5::Fail_FlatDictionary_GrowingLeaksOldTable() {
+	// A table that grew to 128 slots should use the same memory as one that started there
+	size_t grownMemory, startedMemory;
+	{
+		size_t memoryStart = inUse;
+		FlatVectorDict dict(2);
+		FlatInsertVectors(dict, 0, 100);
+		dict.Clear();
+		grownMemory = inUse - memoryStart;
+	}
+	{
+		size_t memoryStart = inUse;
+		FlatVectorDict dict(128);
+		FlatInsertVectors(dict, 0, 100);
+		dict.Clear();
+		startedMemory = inUse - memoryStart;
+	}
+
+	FailResult result;
+	result.check = grownMemory != startedMemory;
+	result.msg = "Memory was not freed when the table doubled";
+
+	return result;
+}
+
+FailResult UnitTests_Lab5::Fail_FlatDictionary_AssignmentLeaksOldValues() {
+	size_t memoryStart = inUse;
+	{
+		FlatVectorDict dict(16), copy(16), moveFrom(16);
+		FlatInsertVectors(dict, 0, 10);
+		FlatInsertVectors(copy, 100, 5);
+		FlatInsertVectors(moveFrom, 200, 5);
+
+		copy = dict;
+		moveFrom = std::move(dict);
+	}
+
+	FailResult result;
+	result.check = inUse != memoryStart;
+	result.msg = "Copy or move assignment did not free the old values";
+
+	return result;
+}
+
+FailResult UnitTests_Lab5::Fail_FlatDictionary_DestructorLeaksValues() {
+	size_t memoryStart = inUse;
+	{
+		FlatVectorDict dict(16);
+		FlatInsertVectors(dict, 0, 10);
+	}
+
+	FailResult result;
+	result.check = inUse != memoryStart;
+	result.msg = "Memory was not freed";
+
+	return result;
+}
+#pragma endregion
+
+#pragma region Pass Tests
+// New keys are found with their values, overwriting keeps the size, missing keys are not found
+bool UnitTests_Lab5::Pass_FlatDictionary_InsertAndFindAreCorrect() {
+	FlatDict dict(8);
+	FlatInsertKeys(dict, 0, 100);
+	bool result = dict.Size() == 100 && FlatKeysFound(dict, 0, 100) && dict.Find(100.0f) == nullptr;
+
+	dict.Insert(5.0f, -1.0f);
+	const float* value = dict.Find(5.0f);
+
+	return result && dict.Size() == 100 && value != nullptr && *value == -1.0f;
+}
+
+// Remove takes out only its key, Clear empties the table without shrinking it
+bool UnitTests_Lab5::Pass_FlatDictionary_RemoveAndClearAreCorrect() {
+	FlatDict dict(8);
+	FlatInsertKeys(dict, 0, 100);
+
+	bool result = true;
+	for (int i = 0; i < 100; i += 2)
+		result = dict.Remove((float)i) && result;
+	result = result && !dict.Remove(0.0f) && !dict.Remove(1000.0f) && dict.Size() == 50;
+	for (int i = 0; i < 100 && result; ++i)
+		result = (dict.Find((float)i) != nullptr) == (i % 2 == 1);
+
+	size_t buckets = dict.BucketCount();
+	dict.Clear();
+	result = result && dict.Size() == 0 && dict.BucketCount() == buckets && dict.Find(1.0f) == nullptr;
+
+	FlatInsertKeys(dict, 0, 10);
+	return result && dict.Size() == 10 && FlatKeysFound(dict, 0, 10);
+}
+
+// Removes from the front, middle and back of one long probe run
+bool UnitTests_Lab5::Pass_FlatDictionary_RemoveInProbeRunKeepsKeys() {
+	FlatDictionary<float, float, FlatCollidingHash> dict(16);
+	FlatInsertKeys(dict, 0, 8);
+
+	bool result = dict.Remove(3.0f) && dict.Find(3.0f) == nullptr &&
+		FlatKeysFound(dict, 0, 3) && FlatKeysFound(dict, 4, 4);
+
+	result = result && dict.Remove(0.0f) && dict.Remove(7.0f) && dict.Size() == 5 &&
+		FlatKeysFound(dict, 1, 2) && FlatKeysFound(dict, 4, 3) && !dict.Remove(3.0f);
+
+	FlatInsertKeys(dict, 3, 1);
+	return result && dict.Size() == 6 && FlatKeysFound(dict, 1, 6);
+}
+
+// Reserve and SetMaxLoadFactor grow the table to a power of 2 that keeps every key
+bool UnitTests_Lab5::Pass_FlatDictionary_GrowthIsCorrect() {
+	FlatDict dict(2);
+	dict.Reserve(100);
+	size_t reserved = dict.BucketCount();
+	FlatInsertKeys(dict, 0, 100);
+
+	bool result = reserved == 128 && dict.BucketCount() == reserved && FlatKeysFound(dict, 0, 100);
+
+	// Clamped to 0.25, so 100 pairs need 512 slots
+	dict.SetMaxLoadFactor(0.01f);
+	result = result && dict.BucketCount() == 512 && FlatKeysFound(dict, 0, 100);
+
+	// Clamped to 0.95, so the table never gets completely full
+	FlatDict full(2);
+	full.SetMaxLoadFactor(2.0f);
+	FlatInsertKeys(full, 0, 64);
+
+	return result && full.LoadFactor() <= 0.95f && full.Size() == 64 && FlatKeysFound(full, 0, 64);
+}
+
+// Both moved-from objects act like empty dictionaries, and can be used again
+bool UnitTests_Lab5::Pass_FlatDictionary_MovedFromObjectIsUsable() {
+	FlatDict dict;
+	FlatInsertKeys(dict, 0, 20);
+
+	FlatDict moveTo(std::move(dict));
+	FlatDict assignTo;
+	FlatInsertKeys(assignTo, 100, 5);
+	assignTo = std::move(moveTo);
+
+	bool result = assignTo.Size() == 20 && FlatKeysFound(assignTo, 0, 20) && assignTo.Find(100.0f) == nullptr &&
+		dict.Size() == 0 && dict.Find(0.0f) == nullptr && !dict.Remove(0.0f) &&
+		moveTo.Size() == 0 && moveTo.Find(0.0f) == nullptr && !moveTo.Remove(0.0f);
+
+	FlatInsertKeys(dict, 0, 20);
+	FlatInsertKeys(moveTo, 0, 20);
+	return result && FlatKeysFound(dict, 0, 20) && FlatKeysFound(moveTo, 0, 20);
+}
+
+// Values that own memory are freed by Remove, Clear, growing and destruction
+bool UnitTests_Lab5::Pass_FlatDictionary_MemoryIsRestored() {
+	size_t memoryStart = inUse;
+	{
+		FlatDictionary<int, std::vector<int>> dict(2);
+		for (int i = 0; i < 200; ++i)
+			dict.Insert(i, std::vector<int>(8, i));
+		for (int i = 0; i < 200; i += 3)
+			dict.Remove(i);
+
+		FlatDictionary<int, std::vector<int>> copy(dict);
+		copy.Insert(1000, std::vector<int>(8, 1000));
+		dict = copy;
+		copy.Clear();
+		copy = std::move(dict);
+	}
+	return inUse == memoryStart;
+}
+#pragma endregion
+#endif
+#pragma endregion
 #endif
\ No newline at end of file
@@ -17,12 +17,15 @@ Notes:			Property of Full Sail University
 /************/
 #include "UnitTestHelper.h"
 #include "..\\Dictionary.h"
+#include "..\\FlatDictionary.h"
 
 class UnitTests_Lab5 {
 #if LAB_5
 public:
 	using Dict = Dictionary<float, float>;
 	using Pair = Dict::Pair;
+	using FlatDict = FlatDictionary<float, float>;
+	using FlatVectorDict = FlatDictionary<int, std::vector<int>>;
 
 	struct DictionaryWithValues {
 		Dict* dict;
@@ -191,5 +194,76 @@ public:
 	static bool Pass_Copy_Constructor_NumBucketsIsCorrectValue();
 	static bool Pass_Copy_Constructor_HashFuncIsCorrectValue();
 #pragma endregion
+#pragma region Test - Move Semantics
+	static void Battery_MoveSemantics();
+
+	static FailResult Fail_MoveSemantics_MemoryIsAllocated();
+	static FailResult Fail_MoveSemantics_TableIsNotTransferred();
+	static FailResult Fail_MoveSemantics_ArgumentIsNotEmpty();
+	static FailResult Fail_MoveSemantics_ArgumentIsNotUsable();
+
+	static bool Pass_MoveSemantics_NoMemoryAllocated();
+	static bool Pass_MoveSemantics_TableIsTransferred();
+	static bool Pass_MoveSemantics_ArgumentIsEmpty();
+	static bool Pass_MoveSemantics_ArgumentIsUsable();
+#pragma endregion
+#pragma region Test - Rehash
+	static void Battery_Rehash();
+
+	static FailResult Fail_Rehash_OverwriteChangesSize();
+	static FailResult Fail_Rehash_RemoveDoesNotUpdateSize();
+	static FailResult Fail_Rehash_GrowsBeforeLimit();
+	static FailResult Fail_Rehash_BucketsDoNotDouble();
+	static FailResult Fail_Rehash_LowLoadFactorIsNotClamped();
+	static FailResult Fail_Rehash_HighLoadFactorIsNotClamped();
+	static FailResult Fail_Rehash_NegativeLoadFactorGrows();
+	static FailResult Fail_Rehash_EmptyTableDoesNotGrow();
+	static FailResult Fail_Rehash_FullRehashLosesKeys();
+	static FailResult Fail_Rehash_IncrementalRehashLosesKeys();
+	static FailResult Fail_Rehash_RemoveMissesUnmovedKey();
+	static FailResult Fail_Rehash_IncrementalRehashNeverFinishes();
+	static FailResult Fail_Rehash_CopyDuringRehashLosesKeys();
+	static FailResult Fail_Rehash_SwapDuringRehashLosesKeys();
+	static FailResult Fail_Rehash_MoveDuringRehashLosesKeys();
+	static FailResult Fail_Rehash_OldTableLeaks();
+	static FailResult Fail_Rehash_DestructorLeaksOldTable();
+
+	static bool Pass_Rehash_SizeIsCorrect();
+	static bool Pass_Rehash_BucketsDouble();
+	static bool Pass_Rehash_LoadFactorIsClamped();
+	static bool Pass_Rehash_KeysAreFound();
+	static bool Pass_Rehash_CopyOrSwapDuringRehashKeepsKeys();
+	static bool Pass_Rehash_MemoryIsRestored();
+#pragma endregion
+#pragma region Test - FlatDictionary
+	static void Battery_FlatDictionary();
+
+	static FailResult Fail_FlatDictionary_OverwriteAddsPair();
+	static FailResult Fail_FlatDictionary_OverwriteKeepsOldValue();
+	static FailResult Fail_FlatDictionary_MissingKeyIsFound();
+	static FailResult Fail_FlatDictionary_GrowingLosesKeys();
+	static FailResult Fail_FlatDictionary_RemoveLeavesKey();
+	static FailResult Fail_FlatDictionary_RemoveMissingKeySucceeds();
+	static FailResult Fail_FlatDictionary_RemoveInProbeRunLosesKeys();
+	static FailResult Fail_FlatDictionary_ClearLeavesPairs();
+	static FailResult Fail_FlatDictionary_ClearShrinksTable();
+	static FailResult Fail_FlatDictionary_ReserveIsWrongSize();
+	static FailResult Fail_FlatDictionary_LowLoadFactorIsNotClamped();
+	static FailResult Fail_FlatDictionary_HighLoadFactorIsNotClamped();
+	static FailResult Fail_FlatDictionary_MovedFromObjectIsNotEmpty();
+	static FailResult Fail_FlatDictionary_MovedFromObjectIsNotUsable();
+	static FailResult Fail_FlatDictionary_MoveAssignmentKeepsOldPairs();
+	static FailResult Fail_FlatDictionary_RemoveLeaksValues();
+	static FailResult Fail_FlatDictionary_GrowingLeaksOldTable();
+	static FailResult Fail_FlatDictionary_AssignmentLeaksOldValues();
+	static FailResult Fail_FlatDictionary_DestructorLeaksValues();
+
+	static bool Pass_FlatDictionary_InsertAndFindAreCorrect();
+	static bool Pass_FlatDictionary_RemoveAndClearAreCorrect();
+	static bool Pass_FlatDictionary_RemoveInProbeRunKeepsKeys();
+	static bool Pass_FlatDictionary_GrowthIsCorrect();
+	static bool Pass_FlatDictionary_MovedFromObjectIsUsable();
+	static bool Pass_FlatDictionary_MemoryIsRestored();
+#pragma endregion
 #endif
 };
\ No newline at end of file
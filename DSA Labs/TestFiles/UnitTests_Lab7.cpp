@@ -108,6 +108,9 @@ void UnitTests_Lab7::FullBattery() {
 #if BST_COPY_CTOR
 	Battery_CopyConstructor();
 #endif
+#if BST_MOVE_SEMANTICS
+	Battery_MoveSemantics();
+#endif
 }
 
 /*
@@ -3530,4 +3533,120 @@ bool UnitTests_Lab7::Pass_InOrder_ValuesAreInCorrectOrder() {
 #pragma endregion
 #endif
 #pragma endregion
+
+#pragma region Test - Move Semantics
+#if BST_MOVE_SEMANTICS
+void UnitTests_Lab7::Battery_MoveSemantics() {
+	FailVector failVec;
+	failVec.push_back(Fail_MoveSemantics_MemoryIsAllocated);
+	failVec.push_back(Fail_MoveSemantics_TreeIsNotTransferred);
+	failVec.push_back(Fail_MoveSemantics_ArgumentIsNotEmpty);
+
+	PassVector passVec;
+	passVec.push_back(Pass_MoveSemantics_NoMemoryAllocated);
+	passVec.push_back(Pass_MoveSemantics_TreeIsTransferred);
+	passVec.push_back(Pass_MoveSemantics_ArgumentIsEmpty);
+
+	UnitTestBattery("Testing move constructor and move assignment", failVec, passVec);
+}
+
+#pragma region Fail Tests
+FailResult UnitTests_Lab7::Fail_MoveSemantics_MemoryIsAllocated() {
+	BST* original = GenerateTree();
+	BST assignTo;
+
+	size_t memoryDeltaStart = inUse;
+	BST moveTo(std::move(*original));
+	assignTo = std::move(moveTo);
+	size_t memoryDeltaEnd = inUse;
+
+	FailResult result;
+	result.check = memoryDeltaEnd != memoryDeltaStart;
+	result.msg = "Memory was allocated while moving";
+
+	delete original;
+	return result;
+}
+
+FailResult UnitTests_Lab7::Fail_MoveSemantics_TreeIsNotTransferred() {
+	BST* original = GenerateTree();
+	Node* root = original->mRoot;
+	BST assignTo;
+
+	BST moveTo(std::move(*original));
+	assignTo = std::move(moveTo);
+
+	FailResult result;
+	result.check = assignTo.mRoot != root;
+	result.msg = "Tree was not handed over to the invoking object";
+
+	delete original;
+	return result;
+}
+
+FailResult UnitTests_Lab7::Fail_MoveSemantics_ArgumentIsNotEmpty() {
+	BST* original = GenerateTree();
+	BST assignTo;
+
+	BST moveTo(std::move(*original));
+	assignTo = std::move(moveTo);
+
+	FailResult result;
+	result.check = original->mRoot != nullptr || moveTo.mRoot != nullptr;
+	result.msg = "Moved-from tree still holds the nodes";
+
+	// Preventing crash
+	if (result.check)
+		original->mRoot = moveTo.mRoot = nullptr;
+
+	delete original;
+	return result;
+}
+#pragma endregion
+
+#pragma region Pass Tests
+bool UnitTests_Lab7::Pass_MoveSemantics_NoMemoryAllocated() {
+	BST* original = GenerateTree();
+	BST assignTo;
+
+	size_t memoryDeltaStart = inUse;
+	BST moveTo(std::move(*original));
+	assignTo = std::move(moveTo);
+	size_t memoryDeltaEnd = inUse;
+
+	bool result = memoryDeltaEnd == memoryDeltaStart;
+
+	delete original;
+	return result;
+}
+
+bool UnitTests_Lab7::Pass_MoveSemantics_TreeIsTransferred() {
+	BST* original = GenerateTree();
+	Node* root = original->mRoot;
+	BST assignTo;
+
+	BST moveTo(std::move(*original));
+	assignTo = std::move(moveTo);
+
+	bool result = assignTo.mRoot == root;
+
+	delete original;
+	return result;
+}
+
+bool UnitTests_Lab7::Pass_MoveSemantics_ArgumentIsEmpty() {
+	BST* original = GenerateTree();
+	BST assignTo;
+
+	BST moveTo(std::move(*original));
+	assignTo = std::move(moveTo);
+
+	bool result = original->mRoot == nullptr && moveTo.mRoot == nullptr;
+
+	delete original;
+	return result;
+}
+#pragma endregion
+#endif
+#pragma endregion
 #endif
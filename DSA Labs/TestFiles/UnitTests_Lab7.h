@@ -390,5 +390,16 @@ public:
 
 	static bool Pass_InOrder_ValuesAreInCorrectOrder();
 #pragma endregion
+#pragma region Test - Move Semantics
+	static void Battery_MoveSemantics();
+
+	static FailResult Fail_MoveSemantics_MemoryIsAllocated();
+	static FailResult Fail_MoveSemantics_TreeIsNotTransferred();
+	static FailResult Fail_MoveSemantics_ArgumentIsNotEmpty();
+
+	static bool Pass_MoveSemantics_NoMemoryAllocated();
+	static bool Pass_MoveSemantics_TreeIsTransferred();
+	static bool Pass_MoveSemantics_ArgumentIsEmpty();
+#pragma endregion
 #endif
 };
\ No newline at end of file
@@ -0,0 +1,512 @@
+/*
+File:			UnrolledDList.h
+Author(s):
+	Student: Terry Ellison <ellisonterry4@gmail.com>
+
+Created:		10.18.2026
+Last Modified:	10.18.2026
+Purpose:		An unrolled doubly-linked list (each node holds up to K elements)
+				with the same interface as DList
+*/
+
+// Header protection
+#pragma once
+
+/************/
+/* Includes */
+/************/
+#include <cstddef>
+#include <new>
+#include <utility>
+#include <algorithm>
+
+// A doubly-linked list of small arrays
+//		Neighbouring elements share a node, so walking the list mostly reads
+//		contiguous memory, and the two link pointers are paid once per K elements
+//		Full nodes split in half on insert, and half-empty nodes merge with
+//		their next node on erase
+template<typename Type, size_t K = 16>
+class UnrolledDList {
+
+	friend class UnitTests_Lab3;	// Giving access to test code
+
+	static_assert(K >= 2, "UnrolledDList needs room for at least two elements per node");
+
+	struct Node {
+		alignas(Type) unsigned char storage[sizeof(Type) * K];	// Raw storage for the elements
+		size_t count = 0;										// Number of live elements (always at the front)
+		Node* next = nullptr;
+		Node* prev = nullptr;
+
+		// Return: The first element of the node
+		Type* Data() {
+			return reinterpret_cast<Type*>(storage);
+		}
+	};
+
+public:
+
+	class Iterator {
+	public:
+
+		Node* mCurr = nullptr;		// Node of the current element (null at the end)
+		size_t mIndex = 0;			// Position of the current element in its node
+
+		// Pre-fix increment operator
+		//
+		// Return: Invoking object pointing at the next element
+		Iterator& operator++() {
+			if (++mIndex == mCurr->count)
+			{
+				mCurr = mCurr->next;
+				mIndex = 0;
+			}
+			return *this;
+		}
+
+		// Post-fix increment operator
+		//
+		// In:	(unused)		Post-fix operators take in an unused int, so that the compiler can differentiate
+		//
+		// Return:	An iterator pointing at the "old" element
+		Iterator operator++(int) {
+			Iterator val = *this;
+			++(*this);
+			return val;
+		}
+
+		// Pre-fix decrement operator
+		//
+		// Return: Invoking object pointing at the previous element (null before the head)
+		Iterator& operator--() {
+			if (mIndex != 0)
+				--mIndex;
+			else
+			{
+				mCurr = mCurr->prev;
+				mIndex = mCurr != nullptr ? mCurr->count - 1 : 0;
+			}
+			return *this;
+		}
+
+		// Post-fix decrement operator
+		//
+		// In:	(unused)		Post-fix operators take in an unused int, so that the compiler can differentiate
+		//
+		// Return:	An iterator pointing at the "old" element
+		Iterator operator--(int) {
+			Iterator val = *this;
+			--(*this);
+			return val;
+		}
+
+		// Dereference operator
+		//
+		// Return: The element the iterator is pointing to
+		Type& operator*() {
+			return mCurr->Data()[mIndex];
+		}
+
+		// Not-equal operator
+		//
+		// In:	_iter		The iterator to compare against
+		//
+		// Return: True, if the iterators are not pointing to the same element
+		bool operator != (const Iterator& _iter) const {
+			return mCurr != _iter.mCurr || mIndex != _iter.mIndex;
+		}
+	};
+
+private:
+
+	// Data members
+	Node* mHead = nullptr;
+	Node* mTail = nullptr;
+	size_t mSize = 0;
+
+public:
+
+	// Default constructor
+	//		Creates a new empty list
+	UnrolledDList() = default;
+
+	// Destructor
+	//		Cleans up all dynamically allocated memory
+	~UnrolledDList() {
+		Clear();
+	}
+
+	// Copy constructor
+	//		Used to initialize one object to another
+	// In:	_copy			The object to copy from
+	UnrolledDList(const UnrolledDList& _copy) {
+		*this = _copy;
+	}
+
+	// Assignment operator
+	//		Used to assign one object to another
+	//		The copy packs its nodes completely full
+	// In:	_assign			The object to assign from
+	//
+	// Return: The invoking object (by reference)
+	UnrolledDList& operator=(const UnrolledDList& _assign) {
+		if (this != &_assign)
+		{
+			Clear();
+			for (Node* node = _assign.mHead; node != nullptr; node = node->next)
+			{
+				for (size_t i = 0; i < node->count; ++i)
+				{
+					AddTail(node->Data()[i]);
+				}
+			}
+		}
+		return *this;
+	}
+
+	// Move constructor
+	//		Takes over the nodes of another object without copying them
+	// In:	_move			The object to move from (left empty)
+	UnrolledDList(UnrolledDList&& _move) noexcept {
+		Swap(_move);
+	}
+
+	// Move assignment operator
+	//		Takes over the nodes of another object without copying them
+	// In:	_assign			The object to move from (left empty)
+	//
+	// Return: The invoking object (by reference)
+	UnrolledDList& operator=(UnrolledDList&& _assign) noexcept {
+		if (this != &_assign)
+		{
+			Clear();
+			Swap(_assign);
+		}
+		return *this;
+	}
+
+	// Exchange the contents of two lists
+	// In:	_other			The list to swap with
+	void Swap(UnrolledDList& _other) noexcept {
+		std::swap(mHead, _other.mHead);
+		std::swap(mTail, _other.mTail);
+		std::swap(mSize, _other.mSize);
+	}
+
+	// Exchange the contents of two lists (found by std::swap-style calls)
+	friend void swap(UnrolledDList& _a, UnrolledDList& _b) noexcept {
+		_a.Swap(_b);
+	}
+
+	// Return: The number of elements in the list
+	size_t Size() const {
+		return mSize;
+	}
+
+	// Add a piece of data to the front of the list
+	//
+	// In:	_data			The object to add to the list
+	void AddHead(const Type& _data) {
+		if (mHead == nullptr || mHead->count == K)
+			LinkBefore(mHead, NewNode());
+
+		InsertInNode(mHead, 0, _data);
+	}
+
+	// Add a piece of data to the end of the list
+	//
+	// In:	_data			The object to add to the list
+	void AddTail(const Type& _data) {
+		if (mTail == nullptr || mTail->count == K)
+			LinkBefore(nullptr, NewNode());
+
+		InsertInNode(mTail, mTail->count, _data);
+	}
+
+	// Clear the list of all dynamic memory
+	//		Resets the list to its default state
+	void Clear() {
+		Node* curr = mHead;
+		while (curr != nullptr)
+		{
+			Node* next = curr->next;
+			DeleteNode(curr);
+			curr = next;
+		}
+
+		mHead = nullptr;
+		mTail = nullptr;
+		mSize = 0;
+	}
+
+	// Insert a piece of data *before* the passed-in iterator
+	//		Inserting at End adds to the tail
+	//
+	// In:	_iter		The iterator
+	//		_data		The value to add
+	//
+	// Return:	The iterator
+	// NOTE:	The iterator should now be pointing to the new element
+	Iterator Insert(Iterator& _iter, const Type& _data) {
+		if (_iter.mCurr == nullptr)
+		{
+			AddTail(_data);
+			_iter.mCurr = mTail;
+			_iter.mIndex = mTail->count - 1;
+			return _iter;
+		}
+
+		Node* node = _iter.mCurr;
+		size_t index = _iter.mIndex;
+
+		if (node->count == K)
+		{
+			// Copy first, _data might be one of the elements about to move
+			Type value(_data);
+
+			// Move the back half into a new node after this one
+			Node* half = NewNode();
+			LinkBefore(node->next, half);
+			MoveElements(node, K / 2, half);
+
+			if (index > node->count)
+			{
+				index -= node->count;
+				node = half;
+			}
+
+			InsertInNode(node, index, value);
+		}
+		else
+			InsertInNode(node, index, _data);
+
+		_iter.mCurr = node;
+		_iter.mIndex = index;
+		return _iter;
+	}
+
+	// Erase an element from the list
+	//
+	// In:	_iter		The iterator
+	//
+	// Return:	The iterator
+	// NOTE:	The iterator should now be pointing at the element after the one erased
+	Iterator Erase(Iterator& _iter) {
+		if (mSize == 0 || _iter.mCurr == nullptr)
+			return _iter;
+
+		Node* node = _iter.mCurr;
+		size_t index = _iter.mIndex;
+		EraseInNode(node, index);
+
+		if (node->count == 0)
+		{
+			Node* next = node->next;
+			Unlink(node);
+			DeleteNode(node);
+			_iter.mCurr = next;
+			_iter.mIndex = 0;
+			return _iter;
+		}
+
+		// Keep nodes at least half full by pulling in a small enough next node
+		if (node->count < K / 2 && node->next != nullptr && node->count + node->next->count <= K)
+		{
+			Node* next = node->next;
+			MoveElements(next, 0, node);
+			Unlink(next);
+			DeleteNode(next);
+		}
+
+		if (index < node->count)
+		{
+			_iter.mCurr = node;
+			_iter.mIndex = index;
+		}
+		else
+		{
+			_iter.mCurr = node->next;
+			_iter.mIndex = 0;
+		}
+		return _iter;
+	}
+
+	// Remove every element a predicate accepts
+	//		Works a node at a time, closing gaps inside each node and
+	//		folding each node into the one before it when both fit
+	//
+	// In:	_pred		Returns true for the elements to remove
+	//
+	// Return: The number of elements removed
+	template<typename Predicate>
+	size_t RemoveIf(Predicate _pred) {
+		size_t removed = 0;
+		Node* node = mHead;
+
+		while (node != nullptr)
+		{
+			Node* next = node->next;
+			Type* data = node->Data();
+
+			size_t kept = 0;
+			for (size_t i = 0; i < node->count; ++i)
+			{
+				if (!_pred(data[i]))
+				{
+					if (kept != i)
+						data[kept] = std::move(data[i]);
+					++kept;
+				}
+			}
+			for (size_t i = kept; i < node->count; ++i)
+			{
+				data[i].~Type();
+			}
+
+			removed += node->count - kept;
+			mSize -= node->count - kept;
+			node->count = kept;
+
+			if (node->count == 0)
+			{
+				Unlink(node);
+				DeleteNode(node);
+			}
+			else if (node->prev != nullptr && node->prev->count + node->count <= K)
+			{
+				MoveElements(node, 0, node->prev);
+				Unlink(node);
+				DeleteNode(node);
+			}
+
+			node = next;
+		}
+
+		return removed;
+	}
+
+	// Set an Iterator at the front of the list
+	//
+	// Return: An iterator pointing to the first element
+	Iterator Begin() const {
+		Iterator val{};
+		val.mCurr = mHead;
+		val.mIndex = 0;
+		return val;
+	}
+
+	// Set an Iterator pointing to the end of the list
+	//
+	// Return: An iterator that has its curr pointing to a null pointer
+	Iterator End() const {
+		Iterator val{};
+		val.mCurr = nullptr;
+		val.mIndex = 0;
+		return val;
+	}
+
+private:
+
+	// Allocate an empty node
+	Node* NewNode() {
+		return new Node();
+	}
+
+	// Destroy a node's elements and free it
+	void DeleteNode(Node* _node) {
+		Type* data = _node->Data();
+		for (size_t i = 0; i < _node->count; ++i)
+		{
+			data[i].~Type();
+		}
+		delete _node;
+	}
+
+	// Link a node into the chain
+	//
+	// In:	_before		The node to link in front of (null links at the tail)
+	//		_node		The node to link
+	void LinkBefore(Node* _before, Node* _node) {
+		Node* after = _before;
+		Node* before = _before != nullptr ? _before->prev : mTail;
+
+		_node->prev = before;
+		_node->next = after;
+
+		if (before != nullptr)
+			before->next = _node;
+		else
+			mHead = _node;
+
+		if (after != nullptr)
+			after->prev = _node;
+		else
+			mTail = _node;
+	}
+
+	// Take a node out of the chain (does not free it)
+	void Unlink(Node* _node) {
+		if (_node->prev != nullptr)
+			_node->prev->next = _node->next;
+		else
+			mHead = _node->next;
+
+		if (_node->next != nullptr)
+			_node->next->prev = _node->prev;
+		else
+			mTail = _node->prev;
+	}
+
+	// Put a value into a node that has room for it
+	//
+	// In:	_node		The node
+	//		_index		Where the value goes (later elements shift back one)
+	//		_data		The value
+	void InsertInNode(Node* _node, size_t _index, const Type& _data) {
+		Type* data = _node->Data();
+
+		if (_index == _node->count)
+			::new (data + _index) Type(_data);
+		else
+		{
+			// Copy first, _data might be one of the elements about to shift
+			Type value(_data);
+			::new (data + _node->count) Type(std::move(data[_node->count - 1]));
+			std::move_backward(data + _index, data + _node->count - 1, data + _node->count);
+			data[_index] = std::move(value);
+		}
+
+		++_node->count;
+		++mSize;
+	}
+
+	// Remove a value from a node (later elements shift forward one)
+	void EraseInNode(Node* _node, size_t _index) {
+		Type* data = _node->Data();
+
+		std::move(data + _index + 1, data + _node->count, data + _index);
+		data[_node->count - 1].~Type();
+
+		--_node->count;
+		--mSize;
+	}
+
+	// Move the elements of one node, from a position on, to the end of another
+	//
+	// In:	_from		The node to take elements from
+	//		_first		The first element to move
+	//		_to			The node to add them to (must have room)
+	void MoveElements(Node* _from, size_t _first, Node* _to) {
+		Type* from = _from->Data();
+		Type* to = _to->Data();
+
+		for (size_t i = _first; i < _from->count; ++i)
+		{
+			::new (to + _to->count) Type(std::move(from[i]));
+			from[i].~Type();
+			++_to->count;
+		}
+
+		_from->count = _first;
+	}
+};